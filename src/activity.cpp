@@ -0,0 +1,77 @@
+#include "activity.h"
+
+#include <cmath>
+#include <stdio.h>
+
+#include "activity_tree.h"
+#include "config.h"
+#include "gaitbands.h"
+#include "stepdetect.h"
+
+static Activity activity = ACTIVITY_STILL;
+
+static uint64_t periodEndUs = 0;
+static float sum = 0.0f;
+static float sumSquared = 0.0f;
+static float peak = 0.0f;
+static int count = 0;
+
+static Activity classify(const float *features) {
+  int node = 0;
+  while (activityTree[node].feature >= 0) {
+    const ActivityNode &n = activityTree[node];
+    node = features[n.feature] < n.threshold ? n.left : n.right;
+  }
+  return (Activity)activityTree[node].left;
+}
+
+bool updateActivity(float rate, uint64_t timestampUs) {
+  if (periodEndUs == 0) {
+    periodEndUs = timestampUs + ACTIVITY_PERIOD_US;
+  }
+  sum += rate;
+  sumSquared += rate * rate;
+  if (std::abs(rate) > peak) {
+    peak = std::abs(rate);
+  }
+  count++;
+  if (timestampUs < periodEndUs) {
+    return false;
+  }
+  periodEndUs += ACTIVITY_PERIOD_US;
+
+  float features[FEATURE_COUNT];
+  float mean = sum / count;
+  features[FEATURE_VARIANCE] = sumSquared / count - mean * mean;
+  features[FEATURE_BAND_ENERGY] = gaitBandTotal();
+  features[FEATURE_CADENCE] = stepCadence();
+  features[FEATURE_PEAK_RATE] = peak;
+  activity = classify(features);
+
+  // Same format tools/train_activity.py reads from a serial capture
+  if (DEBUG) {
+    printf("features,%f,%f,%f,%f\n", features[0], features[1], features[2],
+           features[3]);
+  }
+
+  sum = 0.0f;
+  sumSquared = 0.0f;
+  peak = 0.0f;
+  count = 0;
+  return true;
+}
+
+Activity currentActivity() { return activity; }
+
+const char *activityName(Activity value) {
+  switch (value) {
+    case ACTIVITY_WALK:
+      return "walk";
+    case ACTIVITY_RUN:
+      return "run";
+    case ACTIVITY_STAIRS:
+      return "stairs";
+    default:
+      return "still";
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef __ACTIVITY_H
+#define __ACTIVITY_H
+
+#include <stdint.h>
+
+enum Activity : uint8_t {
+  ACTIVITY_STILL,
+  ACTIVITY_WALK,
+  ACTIVITY_RUN,
+  ACTIVITY_STAIRS,
+};
+
+// Feature indices, in the order tools/train_activity.py expects
+enum ActivityFeature : int8_t {
+  FEATURE_VARIANCE,     // variance of the swing-axis rate, (rad/s)^2
+  FEATURE_BAND_ENERGY,  // Goertzel gait band power, (rad/s)^2
+  FEATURE_CADENCE,      // steps per minute
+  FEATURE_PEAK_RATE,    // largest |rate| over the period, rad/s
+  FEATURE_COUNT,
+};
+
+// Decision tree node; feature < 0 marks a leaf whose class is in left
+struct ActivityNode {
+  int8_t feature;
+  float threshold;
+  uint8_t left;   // taken when value < threshold
+  uint8_t right;  // taken otherwise
+};
+
+// Feed one angular rate sample (rad/s) about the swing axis. Once per
+// ACTIVITY_PERIOD_US the features are extracted and classified; returns
+// true when that happened
+bool updateActivity(float rate, uint64_t timestampUs);
+
+Activity currentActivity();
+const char *activityName(Activity value);
+
+#endif
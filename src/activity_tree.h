@@ -0,0 +1,20 @@
+// Generated by tools/train_activity.py, do not edit
+// Thresholds: baseline, hand-tuned
+#ifndef __ACTIVITY_TREE_H
+#define __ACTIVITY_TREE_H
+
+#include "activity.h"
+
+constexpr ActivityNode activityTree[] = {
+    {FEATURE_VARIANCE, 0.05f, 1, 2},  // 0
+    {-1, 0.0f, ACTIVITY_STILL, 0},  // 1
+    {FEATURE_CADENCE, 140.0f, 3, 4},  // 2
+    {FEATURE_CADENCE, 100.0f, 5, 6},  // 3
+    {-1, 0.0f, ACTIVITY_RUN, 0},  // 4
+    {FEATURE_PEAK_RATE, 4.0f, 7, 8},  // 5
+    {-1, 0.0f, ACTIVITY_WALK, 0},  // 6
+    {-1, 0.0f, ACTIVITY_WALK, 0},  // 7
+    {-1, 0.0f, ACTIVITY_STAIRS, 0},  // 8
+};
+
+#endif
@@ -0,0 +1,37 @@
+#include "capture.h"
+
+#include "config.h"
+#include "mbed.h"
+
+#if CAPTURE_RAW && DEBUG
+#error "CAPTURE_RAW needs DEBUG 0: debug output would corrupt the stream"
+#endif
+
+struct CaptureBlock {
+  uint16_t magic;
+  uint16_t sequence;
+  uint16_t count;
+  uint16_t rateHz;
+  int16_t samples[CAPTURE_BLOCK_SAMPLES][3];
+};
+
+static CaptureBlock block = {CAPTURE_MAGIC, 0, 0, 0, {}};
+
+void captureSample(int16_t x, int16_t y, int16_t z, int rateHz) {
+  // Opened on first use so normal builds never claim the console pins
+  static BufferedSerial port(USBTX, USBRX, CAPTURE_BAUD);
+
+  int16_t *sample = block.samples[block.count];
+  sample[0] = x;
+  sample[1] = y;
+  sample[2] = z;
+  block.rateHz = (uint16_t)rateHz;
+  if (++block.count < CAPTURE_BLOCK_SAMPLES) {
+    return;
+  }
+  // One write per block: at CAPTURE_BAUD it takes less than a third of the
+  // time the block took to sample at the default rate
+  port.write(&block, sizeof(block));
+  block.sequence++;
+  block.count = 0;
+}
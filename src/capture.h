@@ -0,0 +1,16 @@
+#ifndef __CAPTURE_H
+#define __CAPTURE_H
+
+#include <stdint.h>
+
+// Raw sample streaming for noise characterization (CAPTURE_RAW in config.h).
+// Samples go out over the USB serial port in binary blocks of
+//
+//   uint16_t magic (CAPTURE_MAGIC), sequence, count, rateHz
+//   int16_t  x, y, z  (count times, as read from OUT_X_L.., little endian)
+//
+// A gap in the sequence numbers means blocks were lost. tools/allan.py
+// reads the stream
+void captureSample(int16_t x, int16_t y, int16_t z, int rateHz);
+
+#endif
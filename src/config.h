@@ -0,0 +1,219 @@
+#ifndef __CONFIG_H
+#define __CONFIG_H
+
+// Noise-derived constants, generated by tools/allan.py
+#include "noise_model.h"
+
+// Define Regs & Configurations --> Gyroscope's settings
+#define CTRL_REG1 0x20
+#define CTRL_REG1_CONFIG 0b01'10'1'1'1'1
+#define CTRL_REG4 0x23  // Second configure to set the DPS // page 33
+#define CTRL_REG4_CONFIG 0b0'0'01'0'00'0
+
+#define CTRL_REG3 0x22  // page 32
+#define CTRL_REG3_CONFIG 0b0'0'0'0'1'000
+
+#define OUT_TEMP 0x26
+#define OUT_X_L 0x28
+
+#define SCALING_FACTOR (17.5f * 0.017453292519943295769236907684886f / 1000.0f)
+
+// Set to 1 to enable debug messages in serrial monitor and to use teleplot.
+// printf is mbed's minimal-printf: field widths are ignored and floats
+// always print with 3 decimals
+#define DEBUG 0
+
+// Set to 1 to stream raw samples at the default rate for tools/allan.py
+// instead of running the pedometer (needs DEBUG 0)
+#define CAPTURE_RAW 0
+
+// Wake-on-motion settings
+// Angular rate (rad/s) on any axis that wakes the board from idle
+#define WAKE_THRESHOLD NOISE_WAKE_THRESHOLD
+// Number of gyro samples (at the idle ODR) the rate must stay above threshold
+#define WAKE_DURATION 2
+// Number of consecutive still ticks before entering idle (~10 s)
+#define IDLE_TICKS 20
+// Upper bound on the time from INT1 to the first full-rate sample
+#define WAKE_LATENCY_MS 20
+
+// Adaptive output data rate settings
+// Rate used at start-up and after idle: 190 Hz, as in CTRL_REG1_CONFIG
+#define ODR_DEFAULT_LEVEL 1
+// Time constant (s) of the running variance and spectral estimates
+#define ODR_TIME_CONSTANT 0.5f
+// Total variance ((rad/s)^2) below which the slowest rate is used
+#define ODR_VARIANCE_QUIET 0.05f
+// Required ratio between the data rate and the signal's RMS frequency
+#define ODR_OVERSAMPLING 20.0f
+// Step down only when the lower rate is this much above what is required
+#define ODR_DOWN_MARGIN 0.7f
+// Minimum time (s) at a rate before stepping down again
+#define ODR_MIN_DWELL 2.0f
+// Samples held after a rate change while the gyro's filters settle
+#define ODR_SETTLE_SAMPLES 2
+// Samples between two rate decisions
+#define ODR_EVAL_SAMPLES 16
+
+// Temperature compensation settings
+// Bins of 4 degC ((OUT_TEMP + 128) >> TEMP_BIN_SHIFT) over the OUT_TEMP range
+#define TEMP_BINS 64
+#define TEMP_BIN_SHIFT 2
+// Samples between two OUT_TEMP reads
+#define TEMP_READ_SAMPLES 256
+// Samples per bias learning block
+#define TEMP_LEARN_SAMPLES 128
+// Block variance (raw LSB^2) below which the gyro is treated as still
+#define TEMP_STILL_VARIANCE NOISE_TEMP_STILL_VARIANCE
+// Blocks after which a bin switches from averaging to a running update
+#define TEMP_LEARN_MAX_BLOCKS 64
+// Minimum time (s) between two writes of the table to flash; the first one
+// comes as soon as the table has learned anything
+#define TEMP_SAVE_INTERVAL_S 600
+// Stack (bytes) of the thread writing the settings to flash
+#define PERSIST_STACK_SIZE 1024
+
+// Step detection settings
+// Peak threshold as a fraction of the recent swing peaks, and its floor (rad/s)
+#define STEP_THRESHOLD_RATIO 0.5f
+#define STEP_MIN_THRESHOLD 1.0f
+// A peak ends once the rate drops below this fraction of the threshold
+#define STEP_HYSTERESIS 0.5f
+// Flip the swing polarity when troughs are this much deeper than peaks
+#define STEP_POLARITY_RATIO 1.5f
+// Weight of a new stride in the peak level and cadence averages
+#define STEP_ADAPT_RATE 0.25f
+// Shortest plausible stride, and the pause after which the gait is forgotten
+#define STEP_MIN_INTERVAL_US 400000ULL
+#define STEP_TIMEOUT_US 2500000ULL
+
+// Principal axis settings
+// Time constant (s) of the running covariance of the angular rate
+#define PRINCIPAL_TIME_CONSTANT 4.0f
+// Squared norm of C v below which the axis estimate is frozen
+#define PRINCIPAL_MIN_ENERGY 1e-4f
+
+// Zero velocity update settings
+// Samples in the short-window energy used to detect the stance phase
+#define ZUPT_WINDOW 16
+// Mean squared angular rate ((rad/s)^2) below which the leg is still
+#define ZUPT_THRESHOLD NOISE_ZUPT_THRESHOLD
+// Weight of a stance sample in the running bias estimate
+#define ZUPT_BIAS_RATE 0.01f
+
+// Session settings
+// Minute roll-ups kept in the session history (4 bytes each)
+#define SESSION_HISTORY_MINUTES 480
+
+// Spectral estimator settings
+// Analysis rate (Hz) the swing-axis rate is averaged down to
+#define SPECTRUM_RATE 32
+// FFT length (power of two) and hop in decimated samples: an 8 s window,
+// 0.125 Hz bins, one spectrum per second
+#define SPECTRUM_SIZE 256
+#define SPECTRUM_HOP 32
+// Gait band (Hz) searched for the stride frequency
+#define SPECTRUM_BAND_LOW 0.5f
+#define SPECTRUM_BAND_HIGH 3.0f
+// FFT backend: 1 for CMSIS-DSP's arm_rfft_fast_f32, which neither mbed OS
+// nor PlatformIO provides, so add the library and build with
+// -D SPECTRUM_CMSIS=1; 0 for the portable FFT in spectrum.cpp
+#ifndef SPECTRUM_CMSIS
+#define SPECTRUM_CMSIS 0
+#endif
+
+// Goertzel gait band settings; the bin centres are in gaitbands.cpp
+// Rate (Hz) the swing-axis rate is averaged down to before the bank
+#define GAIT_BANDS_RATE 32
+
+// Activity classifier settings; the decision tree is in activity_tree.h
+// Time (us) over which the features are taken
+#define ACTIVITY_PERIOD_US 1000000ULL
+
+// Orientation settings
+// Drift of |q|^2 from 1 tolerated before renormalising
+#define ORIENTATION_NORM_TOLERANCE 1e-4f
+// Longest gap (in sample periods, the gyro FIFO's depth) integrated with
+// the latest rate; a longer stall counts as this long
+#define ORIENTATION_MAX_GAP 32
+
+// Stride model settings
+// Length (m) of the course walked during calibration
+#define CALIBRATION_DISTANCE 20.0f
+// Fewest strides a calibration walk needs to be used
+#define STRIDE_MIN_CALIBRATION_STRIDES 8
+// Cadence (steps per minute) the cadence term is relative to
+#define STRIDE_REFERENCE_CADENCE 100.0f
+// Prior variance of the unitless coefficients and of the offset (m^2)
+#define STRIDE_PRIOR_VARIANCE 0.1f
+#define STRIDE_PRIOR_OFFSET_VARIANCE 0.01f
+// Variance (m^2) of the distance actually walked on a calibration walk
+#define STRIDE_DISTANCE_VARIANCE 1.0f
+
+// History pyramid settings
+// Levels, each HISTORY_FANOUT times coarser than the one below: with the
+// 0.5 s tick, blocks of 0.5 s, 4 s, 32 s and 256 s
+#define HISTORY_LEVELS 4
+#define HISTORY_FANOUT 8
+// Blocks kept per level (16 bytes each); the coarsest spans about 4.5 h
+#define HISTORY_CAPACITY 64
+
+// Outlier rejection settings
+// Samples in the per-axis window the range and median are taken over
+#define OUTLIER_WINDOW 9
+// A sample is a spike when it is further outside the window's range than
+// this multiple of the range plus the floor (rad/s)
+#define OUTLIER_MARGIN 1.0f
+#define OUTLIER_FLOOR NOISE_OUTLIER_FLOOR
+
+// Raw capture settings, see capture.h
+#define CAPTURE_MAGIC 0x5247  // "GR"
+#define CAPTURE_BLOCK_SAMPLES 32
+#define CAPTURE_BAUD 921600
+
+// Display settings
+// Set to 1 to draw labels and units once into the static layer and only the
+// values into the dynamic layer on top, which LTDC blends with colour keying
+#define DISPLAY_COMPOSITOR 1
+#define DISPLAY_STATIC_LAYER 0
+#define DISPLAY_DYNAMIC_LAYER 1
+
+// Frame pacing settings, see uischedule.h
+// Highest frame rate (Hz) while moving, and while still
+#define UI_FRAME_RATE 8.0f
+#define UI_STILL_FRAME_RATE 0.5f
+// CPU load above which the frame rate is halved, and below which it recovers
+#define UI_LOAD_HIGH 0.7f
+#define UI_LOAD_LOW 0.4f
+// Times the frame rate may be halved
+#define UI_RATE_STEPS 3
+
+// Touch screen settings, see touch.h
+// Points the controller collects before interrupting: more means fewer
+// wake-ups while a finger drags, fewer a snappier slider
+#define TOUCH_FIFO_THRESHOLD 4
+// Points read per I2C burst, at most TS_BURST_POINTS
+#define TOUCH_BURST_POINTS 16
+// Position filter weight, 1 / 2^TOUCH_FILTER_SHIFT per point
+#define TOUCH_FILTER_SHIFT 2
+// Pixels a tap or long press may wander from where it landed
+#define TOUCH_TAP_SLOP 10
+// Hold (ms) that makes a long press
+#define TOUCH_LONG_PRESS_MS 800
+// Swipes cover at least TOUCH_SWIPE_MIN pixels in at most
+// TOUCH_SWIPE_MAX_MS; slower strokes are drags
+#define TOUCH_SWIPE_MIN 60
+#define TOUCH_SWIPE_MAX_MS 600
+// Events waiting for the UI, and the touch thread's stack (bytes)
+#define TOUCH_QUEUE_SIZE 16
+#define TOUCH_STACK_SIZE 1024
+// Range (cm) of the height entry slider
+#define HEIGHT_MIN 100
+#define HEIGHT_MAX 220
+
+// Load meter settings
+// Window (us) the busy fraction is measured over, and the weight of a window
+#define LOAD_WINDOW_US 250000
+#define LOAD_SMOOTHING 0.25f
+
+#endif
@@ -0,0 +1,243 @@
+#include "dashboard.h"
+
+#include <cmath>
+
+#include "config.h"
+#include "widgets.h"
+
+static const Field heightField = {4, "height", "cm", 4};
+static const Field gxField = {5, "gx", "rad/s", 7};
+static const Field gyField = {6, "gy", "rad/s", 7};
+static const Field gzField = {7, "gz", "rad/s", 7};
+static const Field velocityField = {8, "velocity", "m/s", 7};
+static const Field distanceField = {9, "distance", "m", 8};
+static const Field timeField = {10, "time", "s", 8};
+static const Field stepsField = {11, "steps", "", 7};
+static const Field cadenceField = {12, "cadence", "spm", 4};
+static const Field activityField = {13, "activity", "", 6};
+static const Field calibrationField = {14, "calib", "strides", 4};
+
+// Session page: one line per completed minute, latest first
+static const Field minuteFields[DASHBOARD_MINUTES] = {
+    {4, "min -1", "m", 7},  {5, "min -2", "m", 7},  {6, "min -3", "m", 7},
+    {7, "min -4", "m", 7},  {8, "min -5", "m", 7},  {9, "min -6", "m", 7},
+    {10, "min -7", "m", 7}, {11, "min -8", "m", 7}};
+
+// Touch buttons below the fields
+static const Button resetButton = {10, 256, 105, 48, "reset"};
+static const Button recordButton = {125, 256, 105, 48, "record"};
+
+static const Field *const chrome[] = {
+    &heightField,   &gxField,    &gyField,     &gzField,
+    &velocityField, &distanceField, &timeField, &stepsField,
+    &cadenceField,  &activityField};
+
+// What each slot shows, as the integer the formatter would print. The
+// session page reuses the first DASHBOARD_MINUTES slots for its lines
+enum Slot {
+  SLOT_HEIGHT,
+  SLOT_GX,
+  SLOT_GY,
+  SLOT_GZ,
+  SLOT_VELOCITY,
+  SLOT_DISTANCE,
+  SLOT_TIME,
+  SLOT_STEPS,
+  SLOT_CADENCE,
+  SLOT_ACTIVITY,
+  SLOT_CALIBRATION,
+  SLOT_COUNT
+};
+
+static int page = DASHBOARD_LIVE;
+static bool calibrationShown = false;
+static bool drawn = false;
+static intptr_t shown[SLOT_COUNT];
+
+static intptr_t scaled(float value, int decimals) {
+  static const float scales[] = {1.0f, 10.0f, 100.0f};
+  return (intptr_t)lroundf(value * scales[decimals]);
+}
+
+static void slotKeys(const DashboardValues &values, intptr_t keys[]) {
+  if (page == DASHBOARD_SESSION) {
+    for (int i = 0; i < SLOT_COUNT; ++i) {
+      keys[i] = 0;
+    }
+    // -1 for minutes not completed yet, shown blank
+    for (int i = 0; i < DASHBOARD_MINUTES; ++i) {
+      keys[i] = i < values.minutes ? scaled(values.minuteDistance[i], 2) : -1;
+    }
+    return;
+  }
+  keys[SLOT_HEIGHT] = values.height;
+  keys[SLOT_GX] = scaled(values.gx, 2);
+  keys[SLOT_GY] = scaled(values.gy, 2);
+  keys[SLOT_GZ] = scaled(values.gz, 2);
+  keys[SLOT_VELOCITY] = scaled(values.velocity, 2);
+  keys[SLOT_DISTANCE] = scaled(values.distance, 2);
+  keys[SLOT_TIME] = scaled(values.time, 2);
+  keys[SLOT_STEPS] = values.steps;
+  keys[SLOT_CADENCE] = scaled(values.cadence, 0);
+  // Activity names are constant strings, so the pointer identifies them
+  keys[SLOT_ACTIVITY] = (intptr_t)values.activity;
+  keys[SLOT_CALIBRATION] =
+      values.calibrating ? values.calibrationStrides : -1;
+}
+
+static void drawChrome(LCD_DISCO_F429ZI &lcd) {
+  lcd.Clear(LCD_COLOR_WHITE);
+  if (page == DASHBOARD_SESSION) {
+    for (const Field &field : minuteFields) {
+      drawFieldChrome(lcd, field);
+    }
+  } else {
+    for (const Field *field : chrome) {
+      drawFieldChrome(lcd, *field);
+    }
+    if (calibrationShown) {
+      drawFieldChrome(lcd, calibrationField);
+    }
+  }
+  drawButton(lcd, resetButton);
+  drawButton(lcd, recordButton);
+}
+
+void initDashboard(LCD_DISCO_F429ZI &lcd) {
+  lcd.SelectLayer(DISPLAY_STATIC_LAYER);
+  drawChrome(lcd);
+  if (DISPLAY_COMPOSITOR) {
+    // Back colour pixels of the dynamic layer let the static one through
+    lcd.SelectLayer(DISPLAY_DYNAMIC_LAYER);
+    lcd.Clear(LCD_COLOR_WHITE);
+    lcd.SetColorKeying(DISPLAY_DYNAMIC_LAYER, LCD_COLOR_WHITE);
+    lcd.SetLayerVisible(DISPLAY_DYNAMIC_LAYER, ENABLE);
+  }
+  drawn = false;
+}
+
+void setDashboardPage(LCD_DISCO_F429ZI &lcd, int newPage) {
+  page = (newPage % DASHBOARD_PAGES + DASHBOARD_PAGES) % DASHBOARD_PAGES;
+  lcd.SelectLayer(DISPLAY_STATIC_LAYER);
+  drawChrome(lcd);
+  if (DISPLAY_COMPOSITOR) {
+    lcd.SelectLayer(DISPLAY_DYNAMIC_LAYER);
+    lcd.Clear(LCD_COLOR_WHITE);
+  }
+  drawn = false;
+}
+
+int dashboardPage() { return page; }
+
+DashboardControl dashboardControlAt(int x, int y) {
+  if (buttonHit(resetButton, x, y)) {
+    return DASHBOARD_RESET;
+  }
+  if (buttonHit(recordButton, x, y)) {
+    return DASHBOARD_RECORD;
+  }
+  return DASHBOARD_NONE;
+}
+
+bool dashboardChanged(const DashboardValues &values) {
+  if (!drawn) {
+    return true;
+  }
+  intptr_t keys[SLOT_COUNT];
+  slotKeys(values, keys);
+  for (int i = 0; i < SLOT_COUNT; ++i) {
+    if (keys[i] != shown[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Whether a slot must be drawn: everything after a clear, else only
+// what would print differently
+static bool changed(const intptr_t keys[], int slot) {
+  return !drawn || keys[slot] != shown[slot];
+}
+
+static void drawLiveValues(LCD_DISCO_F429ZI &lcd,
+                           const DashboardValues &values,
+                           const intptr_t keys[]) {
+  if (changed(keys, SLOT_HEIGHT)) drawFieldInt(lcd, heightField, values.height);
+  if (changed(keys, SLOT_GX)) drawFieldValue(lcd, gxField, values.gx, 2);
+  if (changed(keys, SLOT_GY)) drawFieldValue(lcd, gyField, values.gy, 2);
+  if (changed(keys, SLOT_GZ)) drawFieldValue(lcd, gzField, values.gz, 2);
+  if (changed(keys, SLOT_VELOCITY)) {
+    drawFieldValue(lcd, velocityField, values.velocity, 2);
+  }
+  if (changed(keys, SLOT_DISTANCE)) {
+    drawFieldValue(lcd, distanceField, values.distance, 2);
+  }
+  if (changed(keys, SLOT_TIME)) drawFieldValue(lcd, timeField, values.time, 2);
+  if (changed(keys, SLOT_STEPS)) {
+    drawFieldInt(lcd, stepsField, (int32_t)values.steps);
+  }
+  if (changed(keys, SLOT_CADENCE)) {
+    drawFieldValue(lcd, cadenceField, values.cadence, 0);
+  }
+  if (changed(keys, SLOT_ACTIVITY)) {
+    drawFieldText(lcd, activityField, values.activity);
+  }
+  if (changed(keys, SLOT_CALIBRATION)) {
+    if (calibrationShown) {
+      drawFieldInt(lcd, calibrationField, values.calibrationStrides);
+    } else if (DISPLAY_COMPOSITOR) {
+      clearField(lcd, calibrationField);
+    }
+  }
+}
+
+static void drawSessionValues(LCD_DISCO_F429ZI &lcd,
+                              const DashboardValues &values,
+                              const intptr_t keys[]) {
+  for (int i = 0; i < DASHBOARD_MINUTES; ++i) {
+    if (!changed(keys, i)) {
+      continue;
+    }
+    if (keys[i] < 0) {
+      drawFieldText(lcd, minuteFields[i], "");
+    } else {
+      drawFieldValue(lcd, minuteFields[i], values.minuteDistance[i], 2);
+    }
+  }
+}
+
+void drawDashboard(LCD_DISCO_F429ZI &lcd, const DashboardValues &values) {
+  intptr_t keys[SLOT_COUNT];
+  slotKeys(values, keys);
+
+  // The calibration line comes and goes with the calibration walk
+  if (page == DASHBOARD_LIVE && values.calibrating != calibrationShown) {
+    calibrationShown = values.calibrating;
+    lcd.SelectLayer(DISPLAY_STATIC_LAYER);
+    if (calibrationShown) {
+      drawFieldChrome(lcd, calibrationField);
+    } else {
+      clearField(lcd, calibrationField);
+    }
+  }
+
+  if (DISPLAY_COMPOSITOR) {
+    lcd.SelectLayer(DISPLAY_DYNAMIC_LAYER);
+  } else {
+    // One layer: everything is cleared, so everything is redrawn
+    drawChrome(lcd);
+    drawn = false;
+  }
+
+  // Only the slots whose printed value changed
+  if (page == DASHBOARD_SESSION) {
+    drawSessionValues(lcd, values, keys);
+  } else {
+    drawLiveValues(lcd, values, keys);
+  }
+
+  for (int i = 0; i < SLOT_COUNT; ++i) {
+    shown[i] = keys[i];
+  }
+  drawn = true;
+}
@@ -0,0 +1,56 @@
+#ifndef __DASHBOARD_H
+#define __DASHBOARD_H
+
+#include <stdint.h>
+
+#include "drivers/LCD_DISCO_F429ZI.h"
+
+// Completed minutes listed on the session page
+#define DASHBOARD_MINUTES 8
+
+// Everything the main screen shows
+struct DashboardValues {
+  int height;
+  float gx, gy, gz;
+  float velocity;
+  float distance;
+  float time;
+  uint32_t steps;
+  float cadence;
+  const char *activity;
+  bool calibrating;
+  int calibrationStrides;
+  // Distance (m) of the latest completed minutes, latest first
+  float minuteDistance[DASHBOARD_MINUTES];
+  int minutes;
+};
+
+// Pages swiped through: the live values, and the session's recent minutes
+enum DashboardPage { DASHBOARD_LIVE, DASHBOARD_SESSION, DASHBOARD_PAGES };
+
+// Set up the main screen once the height is entered. With
+// DISPLAY_COMPOSITOR the labels and units go into the static layer here,
+// and the dynamic layer on top is shown with the back colour keyed out
+void initDashboard(LCD_DISCO_F429ZI &lcd);
+
+// Show another page (wrapping around); its chrome is drawn at once, and
+// its values with the next frame
+void setDashboardPage(LCD_DISCO_F429ZI &lcd, int page);
+int dashboardPage();
+
+// Touch buttons, on every page: reset the session totals (held down), and
+// start or finish a calibration walk (as a long press of the blue button
+// does)
+enum DashboardControl { DASHBOARD_NONE, DASHBOARD_RESET, DASHBOARD_RECORD };
+
+// Button under a touch at (x, y), in display pixels
+DashboardControl dashboardControlAt(int x, int y);
+
+// Whether any value would print differently from what is on screen
+bool dashboardChanged(const DashboardValues &values);
+
+// Redraw the values whose printed form changed; in compositor mode only
+// their slots are touched
+void drawDashboard(LCD_DISCO_F429ZI &lcd, const DashboardValues &values);
+
+#endif
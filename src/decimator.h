@@ -0,0 +1,34 @@
+#ifndef __DECIMATOR_H
+#define __DECIMATOR_H
+
+#include <stdint.h>
+
+// Box-car averages a stream with a varying data rate down to a fixed rate,
+// using the sample timestamps
+template <int RateHz>
+struct Decimator {
+  static constexpr uint64_t periodUs = 1000000ULL / RateHz;
+
+  float sum = 0.0f;
+  int count = 0;
+  uint64_t nextUs = 0;
+
+  // Returns true and sets out once a decimated sample is complete
+  bool update(float value, uint64_t timestampUs, float *out) {
+    if (nextUs == 0) {
+      nextUs = timestampUs + periodUs;
+    }
+    sum += value;
+    count++;
+    if (timestampUs < nextUs) {
+      return false;
+    }
+    nextUs += periodUs;
+    *out = sum / count;
+    sum = 0.0f;
+    count = 0;
+    return true;
+  }
+};
+
+#endif
@@ -29,12 +29,12 @@ LCD_DISCO_F429ZI::LCD_DISCO_F429ZI()
   BSP_LCD_LayerDefaultInit(1, LCD_FRAME_BUFFER_LAYER1);
   BSP_LCD_SelectLayer(1);
   BSP_LCD_Clear(LCD_COLOR_WHITE);
-  BSP_LCD_SetFont(&Font16);
+  BSP_LCD_SetFont(&LCD_DEFAULT_FONT);
   BSP_LCD_SetColorKeying(1, LCD_COLOR_WHITE);
   BSP_LCD_SetLayerVisible(1, DISABLE);
   BSP_LCD_LayerDefaultInit(0, LCD_FRAME_BUFFER_LAYER0);
   BSP_LCD_SelectLayer(0);
-  BSP_LCD_SetFont(&Font16);
+  BSP_LCD_SetFont(&LCD_DEFAULT_FONT);
   BSP_LCD_DisplayOn();
   BSP_LCD_Clear(LCD_COLOR_WHITE);  
 }
@@ -204,6 +204,11 @@ void LCD_DISCO_F429ZI::DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
   BSP_LCD_DrawBitmap(X, Y, pBmp);
 }
 
+void LCD_DISCO_F429ZI::DrawPackedBitmap(uint32_t X, uint32_t Y, const sBITMAP *pBitmap)
+{
+  BSP_LCD_DrawPackedBitmap(X, Y, pBitmap);
+}
+
 void LCD_DISCO_F429ZI::FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
 {
   BSP_LCD_FillRect(Xpos, Ypos, Width, Height);
@@ -229,6 +234,16 @@ void LCD_DISCO_F429ZI::FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
   BSP_LCD_FillEllipse(Xpos, Ypos, XRadius, YRadius);
 }
 
+void LCD_DISCO_F429ZI::DrawLineAA(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+{
+  BSP_LCD_DrawLineAA(X1, Y1, X2, Y2);
+}
+
+void LCD_DISCO_F429ZI::FillCircleAA(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+  BSP_LCD_FillCircleAA(Xpos, Ypos, Radius);
+}
+
 void LCD_DISCO_F429ZI::DisplayOn(void)
 {
   BSP_LCD_DisplayOn();
@@ -312,6 +312,15 @@ public:
     */
   void DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp);
 
+  /**
+    * @brief  Displays a palette bitmap packed by tools/pack_bitmaps.py.
+    * @param  X: the bitmap x position in the LCD
+    * @param  Y: the bitmap Y position in the LCD
+    * @param  pBitmap: the bitmap, e.g. from bitmap_pack.h
+    * @retval None
+    */
+  void DrawPackedBitmap(uint32_t X, uint32_t Y, const sBITMAP *pBitmap);
+
   /**
     * @brief  Displays a full rectangle.
     * @param  Xpos: the X position
@@ -361,6 +370,25 @@ public:
     */
   void FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
 
+  /**
+    * @brief  Displays an anti-aliased line (between two points).
+    * @param  X1: the point 1 X position
+    * @param  Y1: the point 1 Y position
+    * @param  X2: the point 2 X position
+    * @param  Y2: the point 2 Y position
+    * @retval None
+    */
+  void DrawLineAA(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
+
+  /**
+    * @brief  Displays a full circle with an anti-aliased edge.
+    * @param  Xpos: the X position
+    * @param  Ypos: the Y position
+    * @param  Radius: the circle radius
+    * @retval None
+    */
+  void FillCircleAA(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
+
   /**
     * @brief  Enables the Display.
     * @param  None
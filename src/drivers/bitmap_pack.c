@@ -0,0 +1,691 @@
+/* Generated by tools/pack_bitmaps.py, do not edit */
+#include "bitmap_pack.h"
+
+static const uint32_t Bitmap_splash_Palette[] = {
+  0xFF292C36, 0xFF414350, 0xFF464B5B, 0xFF8EC3DF, 0xFF667385, 0xFF425369, 0xFF3F5E78, 0xFF3F6E92,
+  0xFFC7C1B1, 0xFFB9DCEB, 0xFF686566, 0xFF585259, 0xFF5D555A, 0xFF7B4951, 0xFF7E8189, 0xFF98918F,
+};
+
+static const uint8_t Bitmap_splash_Data[] = {
+  0xF0, 0x09, 0xF0, 0x09, 0xF0, 0x09, 0xF0, 0x09, 0x9E, 0x09, 0x12, 0x08, 0x40, 0x09, 0x84, 0x09,
+  0x01, 0x08, 0x19, 0x09, 0x12, 0x08, 0x40, 0x09, 0x5C, 0x09, 0x12, 0x08, 0x16, 0x09, 0x01, 0x08,
+  0x19, 0x09, 0x12, 0x08, 0x40, 0x09, 0x5C, 0x09, 0x12, 0x08, 0x16, 0x09, 0x01, 0x08, 0x19, 0x09,
+  0x12, 0x08, 0x40, 0x09, 0x5C, 0x09, 0x12, 0x08, 0x16, 0x09, 0x01, 0x08, 0x19, 0x09, 0x12, 0x08,
+  0x40, 0x09, 0x5C, 0x09, 0x12, 0x08, 0x16, 0x09, 0x01, 0x08, 0x19, 0x09, 0x03, 0x08, 0x01, 0x0E,
+  0x01, 0x08, 0x01, 0x0E, 0x02, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0F, 0x04, 0x08, 0x40, 0x09, 0x5C, 0x09, 0x12, 0x08, 0x16, 0x09, 0x01, 0x08, 0x19, 0x09,
+  0x02, 0x08, 0x02, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x00,
+  0x01, 0x08, 0x01, 0x0A, 0x02, 0x08, 0x01, 0x0F, 0x03, 0x08, 0x40, 0x09, 0x5C, 0x09, 0x03, 0x08,
+  0x01, 0x0F, 0x01, 0x08, 0x02, 0x0F, 0x04, 0x08, 0x01, 0x0F, 0x06, 0x08, 0x16, 0x09, 0x01, 0x08,
+  0x19, 0x09, 0x02, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F,
+  0x01, 0x0C, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x04, 0x08, 0x40, 0x09,
+  0x5C, 0x09, 0x03, 0x08, 0x01, 0x0F, 0x02, 0x08, 0x03, 0x0F, 0x02, 0x0E, 0x01, 0x08, 0x01, 0x0E,
+  0x01, 0x08, 0x01, 0x0A, 0x03, 0x08, 0x16, 0x09, 0x01, 0x08, 0x19, 0x09, 0x03, 0x08, 0x01, 0x0F,
+  0x0E, 0x08, 0x40, 0x09, 0x5C, 0x09, 0x04, 0x08, 0x01, 0x0E, 0x01, 0x08, 0x02, 0x0F, 0x02, 0x0E,
+  0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x0E, 0x04, 0x08, 0x16, 0x09, 0x01, 0x08, 0x19, 0x09,
+  0x12, 0x08, 0x40, 0x09, 0x5C, 0x09, 0x03, 0x08, 0x01, 0x0F, 0x07, 0x08, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0F, 0x04, 0x08, 0x16, 0x09, 0x01, 0x08, 0x19, 0x09, 0x12, 0x08, 0x40, 0x09, 0x5C, 0x09,
+  0x12, 0x08, 0x16, 0x09, 0x01, 0x08, 0x19, 0x09, 0x12, 0x08, 0x40, 0x09, 0x5C, 0x09, 0x12, 0x08,
+  0x16, 0x09, 0x01, 0x08, 0x19, 0x09, 0x12, 0x08, 0x40, 0x09, 0x5C, 0x09, 0x12, 0x08, 0x16, 0x09,
+  0x01, 0x08, 0x19, 0x09, 0x11, 0x08, 0x41, 0x09, 0x5C, 0x09, 0x12, 0x08, 0x16, 0x09, 0x01, 0x08,
+  0x6B, 0x09, 0x5C, 0x09, 0x12, 0x08, 0x16, 0x09, 0x01, 0x08, 0x6B, 0x09, 0x84, 0x09, 0x01, 0x08,
+  0x6B, 0x09, 0x50, 0x09, 0x05, 0x08, 0x03, 0x0F, 0x02, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x02, 0x0F,
+  0x01, 0x08, 0x04, 0x0F, 0x01, 0x08, 0x06, 0x0F, 0x03, 0x0E, 0x02, 0x0F, 0x02, 0x08, 0x09, 0x0F,
+  0x0A, 0x09, 0x01, 0x08, 0x0F, 0x09, 0x15, 0x08, 0x0B, 0x0F, 0x04, 0x08, 0x03, 0x0F, 0x01, 0x08,
+  0x34, 0x09, 0x50, 0x09, 0x03, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x02, 0x01, 0x0A, 0x0B, 0x02, 0x01,
+  0x01, 0x06, 0x04, 0x02, 0x08, 0x00, 0x02, 0x0A, 0x01, 0x0B, 0x01, 0x01, 0x03, 0x00, 0x02, 0x01,
+  0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x07, 0x0F, 0x0A, 0x0E, 0x02, 0x0A, 0x01, 0x0E,
+  0x01, 0x0A, 0x01, 0x04, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x00, 0x06, 0x01, 0x04, 0x00, 0x01, 0x01,
+  0x01, 0x0B, 0x02, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x0A, 0x34, 0x09, 0x50, 0x09, 0x01, 0x04,
+  0x01, 0x0A, 0x03, 0x0C, 0x05, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x01, 0x02, 0x04, 0x0B, 0x02, 0x01,
+  0x01, 0x06, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x0A, 0x00, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x05,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x07, 0x0F, 0x01, 0x0E,
+  0x04, 0x0A, 0x05, 0x0E, 0x02, 0x0A, 0x01, 0x0E, 0x03, 0x0A, 0x01, 0x0B, 0x01, 0x00, 0x04, 0x01,
+  0x02, 0x0B, 0x02, 0x01, 0x06, 0x00, 0x02, 0x0B, 0x01, 0x0E, 0x34, 0x09, 0x50, 0x09, 0x01, 0x04,
+  0x02, 0x0A, 0x02, 0x0C, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x08,
+  0x01, 0x0F, 0x01, 0x02, 0x04, 0x0B, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02,
+  0x0D, 0x00, 0x02, 0x01, 0x03, 0x02, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x07, 0x0F, 0x01, 0x0A,
+  0x01, 0x0E, 0x02, 0x08, 0x01, 0x0C, 0x01, 0x0A, 0x03, 0x0E, 0x03, 0x0A, 0x02, 0x04, 0x02, 0x0A,
+  0x01, 0x0B, 0x02, 0x00, 0x04, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x06, 0x00,
+  0x01, 0x01, 0x34, 0x09, 0x50, 0x09, 0x02, 0x0A, 0x01, 0x04, 0x04, 0x0A, 0x01, 0x02, 0x01, 0x01,
+  0x01, 0x0F, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x0A, 0x01, 0x02, 0x03, 0x0B, 0x02, 0x01, 0x01, 0x04,
+  0x01, 0x02, 0x03, 0x05, 0x01, 0x01, 0x07, 0x00, 0x01, 0x02, 0x02, 0x0F, 0x01, 0x02, 0x06, 0x00,
+  0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x06, 0x0F, 0x01, 0x0E, 0x01, 0x0C, 0x01, 0x08, 0x01, 0x0E,
+  0x01, 0x08, 0x02, 0x0C, 0x01, 0x0A, 0x03, 0x0E, 0x02, 0x0A, 0x01, 0x0E, 0x03, 0x04, 0x01, 0x0B,
+  0x02, 0x00, 0x04, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x03, 0x0F, 0x01, 0x01, 0x05, 0x00, 0x01, 0x01,
+  0x34, 0x09, 0x50, 0x09, 0x02, 0x0A, 0x01, 0x0C, 0x04, 0x0A, 0x02, 0x01, 0x01, 0x0E, 0x02, 0x0F,
+  0x01, 0x00, 0x01, 0x02, 0x02, 0x0B, 0x01, 0x02, 0x03, 0x01, 0x0B, 0x00, 0x01, 0x01, 0x01, 0x04,
+  0x02, 0x0F, 0x01, 0x0C, 0x01, 0x02, 0x05, 0x00, 0x01, 0x08, 0x09, 0x09, 0x01, 0x08, 0x0D, 0x09,
+  0x06, 0x0F, 0x02, 0x0C, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x01, 0x02, 0x0C, 0x04, 0x0E,
+  0x02, 0x0B, 0x03, 0x0A, 0x03, 0x00, 0x03, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x03, 0x0F, 0x01, 0x01,
+  0x01, 0x0B, 0x02, 0x01, 0x02, 0x00, 0x01, 0x01, 0x34, 0x09, 0x50, 0x09, 0x02, 0x0A, 0x01, 0x0C,
+  0x03, 0x02, 0x04, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x06, 0x00, 0x03, 0x01, 0x02, 0x0A,
+  0x01, 0x00, 0x01, 0x01, 0x05, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x01, 0x0E,
+  0x02, 0x0A, 0x02, 0x0C, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x0C, 0x03, 0x0D, 0x02, 0x0A, 0x01, 0x0B,
+  0x01, 0x0A, 0x03, 0x0B, 0x01, 0x0C, 0x03, 0x0E, 0x06, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x01, 0x0A,
+  0x01, 0x0F, 0x02, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0B, 0x34, 0x09, 0x50, 0x09, 0x01, 0x04,
+  0x01, 0x0A, 0x01, 0x05, 0x01, 0x02, 0x02, 0x05, 0x01, 0x02, 0x02, 0x01, 0x01, 0x0B, 0x01, 0x01,
+  0x03, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x03, 0x02, 0x06, 0x01, 0x02, 0x02, 0x05, 0x01,
+  0x05, 0x00, 0x01, 0x01, 0x03, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x04, 0x0A,
+  0x03, 0x0C, 0x05, 0x0D, 0x01, 0x0C, 0x01, 0x0A, 0x02, 0x0C, 0x02, 0x0A, 0x01, 0x0C, 0x02, 0x0B,
+  0x01, 0x02, 0x01, 0x0B, 0x01, 0x02, 0x02, 0x0B, 0x01, 0x0C, 0x01, 0x02, 0x03, 0x0B, 0x03, 0x01,
+  0x02, 0x0B, 0x04, 0x01, 0x01, 0x0A, 0x34, 0x09, 0x50, 0x09, 0x01, 0x0A, 0x01, 0x04, 0x06, 0x02,
+  0x02, 0x01, 0x03, 0x0D, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02,
+  0x0F, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x02, 0x0A, 0x01, 0x0C, 0x02, 0x0A, 0x01, 0x0C, 0x06, 0x0D,
+  0x01, 0x0A, 0x01, 0x0C, 0x02, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x02, 0x0C, 0x04, 0x0B, 0x01, 0x0C,
+  0x03, 0x0B, 0x01, 0x02, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x02, 0x01, 0x01,
+  0x01, 0x0B, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x0A, 0x34, 0x09, 0x50, 0x09, 0x02, 0x04, 0x01, 0x05,
+  0x02, 0x02, 0x01, 0x0B, 0x02, 0x02, 0x01, 0x01, 0x05, 0x0D, 0x02, 0x01, 0x01, 0x02, 0x01, 0x0B,
+  0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x08, 0x01, 0x02, 0x00, 0x01, 0x01,
+  0x03, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x0B,
+  0x02, 0x0A, 0x01, 0x0C, 0x03, 0x0D, 0x01, 0x08, 0x01, 0x0F, 0x02, 0x0D, 0x01, 0x0A, 0x01, 0x0C,
+  0x01, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x0C, 0x0A, 0x0B, 0x01, 0x02,
+  0x01, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0B, 0x01, 0x0A, 0x34, 0x09, 0x50, 0x09,
+  0x02, 0x04, 0x02, 0x05, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x0D, 0x01, 0x09, 0x02, 0x0D,
+  0x02, 0x0B, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x0A, 0x01, 0x02, 0x00, 0x01, 0x01,
+  0x04, 0x00, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x01, 0x0C, 0x01, 0x0A,
+  0x03, 0x0C, 0x01, 0x0A, 0x03, 0x0D, 0x01, 0x09, 0x01, 0x08, 0x02, 0x0D, 0x01, 0x0A, 0x03, 0x0C,
+  0x01, 0x0B, 0x02, 0x0C, 0x03, 0x0B, 0x01, 0x0A, 0x03, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x01, 0x01,
+  0x01, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x0B, 0x02, 0x01,
+  0x01, 0x0A, 0x34, 0x09, 0x50, 0x09, 0x02, 0x04, 0x02, 0x02, 0x05, 0x01, 0x05, 0x0D, 0x01, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x05, 0x01,
+  0x03, 0x00, 0x01, 0x01, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x01, 0x0C,
+  0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x02, 0x0C, 0x06, 0x0D, 0x04, 0x0C, 0x01, 0x0B,
+  0x01, 0x0C, 0x01, 0x0B, 0x03, 0x0C, 0x06, 0x0B, 0x01, 0x0C, 0x02, 0x0B, 0x01, 0x02, 0x03, 0x0B,
+  0x03, 0x01, 0x01, 0x02, 0x01, 0x0A, 0x34, 0x09, 0x50, 0x09, 0x02, 0x04, 0x01, 0x02, 0x01, 0x05,
+  0x01, 0x02, 0x03, 0x00, 0x02, 0x01, 0x03, 0x0D, 0x01, 0x01, 0x01, 0x02, 0x02, 0x0B, 0x01, 0x01,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x0E, 0x01, 0x01, 0x00, 0x03, 0x01, 0x0A, 0x09, 0x01, 0x08,
+  0x0D, 0x09, 0x01, 0x0F, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x01, 0x02, 0x00, 0x01, 0x0B,
+  0x05, 0x0D, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x0C, 0x02, 0x0B, 0x02, 0x0C, 0x06, 0x0B,
+  0x01, 0x0C, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0C,
+  0x03, 0x0B, 0x01, 0x0A, 0x34, 0x09, 0x50, 0x09, 0x02, 0x0A, 0x03, 0x05, 0x03, 0x00, 0x04, 0x01,
+  0x01, 0x0B, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x0D, 0x01, 0x08, 0x00,
+  0x02, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x01, 0x0C, 0x02, 0x0A, 0x01, 0x00,
+  0x01, 0x01, 0x01, 0x0D, 0x02, 0x0C, 0x04, 0x0D, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C,
+  0x02, 0x0A, 0x02, 0x0B, 0x01, 0x0C, 0x05, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x02, 0x02, 0x01, 0x01,
+  0x03, 0x00, 0x01, 0x01, 0x03, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x0A, 0x34, 0x09, 0x50, 0x09,
+  0x01, 0x04, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x02, 0x00, 0x01, 0x01, 0x04, 0x02,
+  0x01, 0x0B, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x02, 0x04, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x03, 0x00, 0x03, 0x01, 0x03, 0x00, 0x02, 0x01, 0x0A, 0x09, 0x01, 0x08,
+  0x0D, 0x09, 0x01, 0x0F, 0x01, 0x0B, 0x02, 0x0A, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0A,
+  0x02, 0x0C, 0x01, 0x0A, 0x03, 0x0C, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x0C,
+  0x07, 0x0B, 0x01, 0x0C, 0x03, 0x0B, 0x01, 0x0C, 0x02, 0x00, 0x01, 0x0B, 0x03, 0x01, 0x02, 0x00,
+  0x02, 0x0B, 0x01, 0x0A, 0x34, 0x09, 0x50, 0x09, 0x01, 0x0A, 0x01, 0x04, 0x03, 0x02, 0x01, 0x00,
+  0x04, 0x01, 0x01, 0x02, 0x01, 0x0B, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02,
+  0x05, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x00, 0x01, 0x02,
+  0x01, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0A,
+  0x01, 0x00, 0x01, 0x0B, 0x01, 0x0C, 0x02, 0x0B, 0x02, 0x0C, 0x01, 0x0A, 0x03, 0x0C, 0x01, 0x0B,
+  0x01, 0x0A, 0x01, 0x0B, 0x01, 0x02, 0x02, 0x0B, 0x01, 0x0C, 0x08, 0x0B, 0x01, 0x0A, 0x01, 0x0C,
+  0x04, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x0A, 0x34, 0x09,
+  0x50, 0x09, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x01,
+  0x01, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x02, 0x00,
+  0x02, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x03, 0x0C, 0x01, 0x00, 0x01, 0x0B,
+  0x01, 0x0C, 0x02, 0x0A, 0x02, 0x0C, 0x01, 0x0B, 0x02, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x0C,
+  0x01, 0x0B, 0x01, 0x0C, 0x05, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x01, 0x02, 0x0B,
+  0x01, 0x0C, 0x01, 0x01, 0x01, 0x0C, 0x04, 0x0A, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x01,
+  0x01, 0x0A, 0x34, 0x09, 0x50, 0x09, 0x01, 0x0E, 0x01, 0x0A, 0x02, 0x05, 0x01, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x01, 0x05, 0x02,
+  0x02, 0x01, 0x03, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x02, 0x01, 0x01, 0x0C,
+  0x05, 0x01, 0x02, 0x00, 0x02, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x03, 0x0A,
+  0x01, 0x00, 0x04, 0x0C, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x05, 0x0C, 0x03, 0x0B, 0x01, 0x0C,
+  0x02, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x0A, 0x01, 0x0C, 0x03, 0x0A, 0x02, 0x0C, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0A,
+  0x34, 0x09, 0x50, 0x09, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x05, 0x02, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x0B, 0x04, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x01, 0x02, 0x03, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00, 0x02, 0x01, 0x01, 0x0C, 0x05, 0x01,
+  0x02, 0x00, 0x02, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0C,
+  0x01, 0x0A, 0x01, 0x00, 0x01, 0x0C, 0x02, 0x0B, 0x01, 0x0C, 0x02, 0x0B, 0x01, 0x0C, 0x02, 0x0A,
+  0x02, 0x0C, 0x07, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x03, 0x01, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x0C,
+  0x04, 0x0A, 0x01, 0x0C, 0x01, 0x00, 0x02, 0x01, 0x01, 0x0A, 0x34, 0x09, 0x50, 0x09, 0x01, 0x0E,
+  0x01, 0x04, 0x02, 0x05, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02,
+  0x01, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x00,
+  0x02, 0x01, 0x02, 0x00, 0x02, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0F, 0x02, 0x0A,
+  0x01, 0x0C, 0x01, 0x00, 0x03, 0x0B, 0x03, 0x0C, 0x02, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x02, 0x0C,
+  0x02, 0x0B, 0x01, 0x0C, 0x04, 0x0B, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x00,
+  0x01, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x01, 0x0C, 0x04, 0x0A, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x0A, 0x34, 0x09, 0x50, 0x09, 0x01, 0x0E, 0x01, 0x04, 0x03, 0x05, 0x01, 0x00,
+  0x02, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x0B, 0x04, 0x00, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00,
+  0x02, 0x01, 0x01, 0x0B, 0x07, 0x00, 0x02, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0E,
+  0x03, 0x0A, 0x01, 0x00, 0x02, 0x0C, 0x01, 0x0A, 0x02, 0x0C, 0x03, 0x0B, 0x01, 0x0C, 0x01, 0x0B,
+  0x04, 0x0C, 0x05, 0x0B, 0x01, 0x01, 0x02, 0x0C, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0B,
+  0x01, 0x0C, 0x05, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x0A, 0x34, 0x09,
+  0x11, 0x09, 0x32, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x02, 0x01, 0x05, 0x01, 0x0A,
+  0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x05, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00,
+  0x07, 0x01, 0x04, 0x00, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x0C,
+  0x01, 0x04, 0x01, 0x0A, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0A, 0x02, 0x0C, 0x02, 0x00,
+  0x01, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x01, 0x0C, 0x02, 0x0B, 0x01, 0x0C, 0x03, 0x0B, 0x01, 0x0C,
+  0x01, 0x0B, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x04, 0x1E, 0x09,
+  0x01, 0x08, 0x15, 0x09, 0x11, 0x09, 0x32, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x05,
+  0x01, 0x02, 0x01, 0x05, 0x01, 0x02, 0x01, 0x05, 0x03, 0x02, 0x01, 0x01, 0x04, 0x00, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x05,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x03, 0x01, 0x04, 0x00, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x0C, 0x02, 0x0A, 0x01, 0x0C, 0x02, 0x0B, 0x02, 0x0A,
+  0x01, 0x0B, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x0C,
+  0x01, 0x0B, 0x01, 0x0C, 0x02, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x01, 0x0C,
+  0x01, 0x0A, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x02, 0x0B, 0x03, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x0A, 0x1E, 0x09, 0x01, 0x08, 0x15, 0x09, 0x11, 0x09, 0x32, 0x08,
+  0x0D, 0x09, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x0A, 0x01, 0x0B, 0x02, 0x02, 0x01, 0x05, 0x03, 0x02,
+  0x02, 0x01, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x06, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x04, 0x00, 0x01, 0x01, 0x03, 0x00, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x05, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x01,
+  0x05, 0x00, 0x01, 0x0C, 0x04, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01,
+  0x01, 0x0B, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x0B,
+  0x05, 0x01, 0x01, 0x0A, 0x1E, 0x09, 0x01, 0x08, 0x15, 0x09, 0x11, 0x09, 0x32, 0x08, 0x0D, 0x09,
+  0x01, 0x0E, 0x01, 0x04, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x05, 0x01, 0x02, 0x01, 0x0C,
+  0x01, 0x08, 0x01, 0x0A, 0x02, 0x02, 0x01, 0x01, 0x03, 0x00, 0x03, 0x01, 0x01, 0x02, 0x06, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x02, 0x01,
+  0x02, 0x00, 0x01, 0x01, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x0A,
+  0x05, 0x0C, 0x01, 0x0A, 0x03, 0x0C, 0x04, 0x01, 0x01, 0x0C, 0x07, 0x0B, 0x01, 0x01, 0x01, 0x0B,
+  0x02, 0x00, 0x03, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x02, 0x01, 0x01,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x0A, 0x1E, 0x09, 0x01, 0x08, 0x15, 0x09, 0x11, 0x09, 0x32, 0x08,
+  0x0D, 0x09, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x02, 0x05, 0x00, 0x02, 0x08, 0x01, 0x0A, 0x02, 0x02,
+  0x01, 0x00, 0x01, 0x07, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x05, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x04, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x06, 0x00, 0x01, 0x01, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x02, 0x04, 0x01, 0x01, 0x0B, 0x01, 0x0C,
+  0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x02, 0x07, 0x0B, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x00, 0x03, 0x01, 0x01, 0x0E, 0x01, 0x09, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x01, 0x0A, 0x1E, 0x09, 0x01, 0x08, 0x15, 0x09, 0x11, 0x09, 0x02, 0x08, 0x01, 0x0E, 0x03, 0x0F,
+  0x02, 0x08, 0x01, 0x0F, 0x02, 0x08, 0x01, 0x0A, 0x05, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F,
+  0x01, 0x08, 0x02, 0x0E, 0x01, 0x08, 0x01, 0x0F, 0x0D, 0x08, 0x01, 0x0A, 0x06, 0x08, 0x01, 0x0A,
+  0x01, 0x08, 0x01, 0x0E, 0x1A, 0x08, 0x01, 0x0A, 0x01, 0x02, 0x03, 0x07, 0x01, 0x0A, 0x01, 0x01,
+  0x01, 0x02, 0x08, 0x01, 0x01, 0x0B, 0x01, 0x0C, 0x07, 0x01, 0x05, 0x00, 0x01, 0x01, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x0A, 0x02, 0x00, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x0B,
+  0x01, 0x01, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x01, 0x02, 0x07, 0x01, 0x0A, 0x03, 0x0B,
+  0x01, 0x0C, 0x03, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x02, 0x01, 0x03, 0x0B, 0x01, 0x0C, 0x01, 0x0F,
+  0x02, 0x09, 0x17, 0x08, 0x03, 0x09, 0x01, 0x0A, 0x03, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0F, 0x01, 0x08, 0x01, 0x0E, 0x03, 0x09, 0x01, 0x08, 0x15, 0x09, 0x11, 0x09, 0x02, 0x08,
+  0x01, 0x0F, 0x01, 0x08, 0x03, 0x0F, 0x01, 0x08, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x08, 0x03, 0x0F,
+  0x01, 0x0A, 0x02, 0x08, 0x01, 0x0E, 0x01, 0x0A, 0x06, 0x0F, 0x01, 0x0E, 0x02, 0x0F, 0x01, 0x08,
+  0x03, 0x0F, 0x01, 0x0E, 0x01, 0x0A, 0x02, 0x0E, 0x02, 0x08, 0x01, 0x0F, 0x02, 0x0A, 0x01, 0x0F,
+  0x01, 0x0A, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x1B, 0x08, 0x01, 0x0B, 0x03, 0x07,
+  0x01, 0x0A, 0x02, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x0C, 0x03, 0x01,
+  0x03, 0x00, 0x02, 0x01, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x06, 0x02, 0x00, 0x01, 0x05, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x04, 0x01, 0x0C, 0x01, 0x00, 0x01, 0x02, 0x01, 0x0E, 0x02, 0x0F,
+  0x01, 0x0A, 0x02, 0x0B, 0x01, 0x0C, 0x01, 0x02, 0x03, 0x07, 0x01, 0x0C, 0x01, 0x02, 0x01, 0x0A,
+  0x02, 0x0C, 0x01, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x00,
+  0x01, 0x0C, 0x01, 0x08, 0x18, 0x09, 0x01, 0x08, 0x03, 0x09, 0x01, 0x0A, 0x01, 0x0E, 0x02, 0x0A,
+  0x03, 0x0E, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x0F, 0x03, 0x09, 0x01, 0x08, 0x15, 0x09, 0x11, 0x09,
+  0x02, 0x08, 0x02, 0x0E, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0F, 0x02, 0x08,
+  0x01, 0x0F, 0x01, 0x0E, 0x03, 0x08, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0F,
+  0x01, 0x0E, 0x01, 0x0F, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x0E,
+  0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x03, 0x08, 0x01, 0x0F, 0x01, 0x0E,
+  0x02, 0x0F, 0x02, 0x0E, 0x01, 0x08, 0x02, 0x0F, 0x0F, 0x08, 0x03, 0x0F, 0x01, 0x0E, 0x04, 0x0F,
+  0x03, 0x08, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x06, 0x02, 0x00, 0x01, 0x0C, 0x01, 0x00, 0x02, 0x01,
+  0x01, 0x02, 0x06, 0x01, 0x01, 0x0C, 0x06, 0x00, 0x02, 0x01, 0x02, 0x0B, 0x02, 0x06, 0x01, 0x00,
+  0x01, 0x05, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x0C,
+  0x02, 0x0E, 0x01, 0x04, 0x02, 0x0B, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x02, 0x07, 0x03, 0x01,
+  0x02, 0x0C, 0x01, 0x0B, 0x01, 0x0C, 0x02, 0x0B, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x0C,
+  0x02, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x08, 0x01, 0x09, 0x01, 0x08, 0x01, 0x0A, 0x01, 0x0E,
+  0x01, 0x0A, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x07, 0x01, 0x0A, 0x01, 0x0E, 0x0D, 0x09, 0x01, 0x08,
+  0x03, 0x09, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F,
+  0x01, 0x0A, 0x02, 0x0F, 0x03, 0x09, 0x01, 0x08, 0x15, 0x09, 0x11, 0x09, 0x1A, 0x08, 0x01, 0x0F,
+  0x10, 0x08, 0x01, 0x0F, 0x06, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x02, 0x01, 0x00,
+  0x01, 0x0B, 0x01, 0x0E, 0x02, 0x04, 0x02, 0x08, 0x01, 0x02, 0x01, 0x05, 0x03, 0x01, 0x03, 0x00,
+  0x08, 0x01, 0x01, 0x02, 0x01, 0x01, 0x06, 0x00, 0x03, 0x01, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x07,
+  0x01, 0x00, 0x01, 0x05, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x00,
+  0x01, 0x01, 0x02, 0x0E, 0x01, 0x07, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x02, 0x0B, 0x03, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x0C, 0x08, 0x0B, 0x02, 0x0C, 0x02, 0x00,
+  0x02, 0x0F, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0F, 0x01, 0x04, 0x01, 0x06, 0x01, 0x02,
+  0x01, 0x0A, 0x1E, 0x09, 0x01, 0x08, 0x15, 0x09, 0x11, 0x09, 0x32, 0x08, 0x0D, 0x09, 0x01, 0x0E,
+  0x01, 0x0A, 0x01, 0x02, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x04, 0x02, 0x0E, 0x04, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x07, 0x01,
+  0x02, 0x00, 0x03, 0x01, 0x01, 0x0B, 0x01, 0x04, 0x01, 0x07, 0x01, 0x01, 0x01, 0x06, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x04, 0x01, 0x02, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x04,
+  0x01, 0x06, 0x01, 0x0A, 0x02, 0x0C, 0x01, 0x0A, 0x02, 0x0B, 0x02, 0x01, 0x06, 0x0B, 0x01, 0x01,
+  0x02, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x06, 0x01, 0x01, 0x02, 0x01, 0x0A, 0x01, 0x00, 0x01, 0x0B,
+  0x01, 0x01, 0x01, 0x0F, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01, 0x01, 0x0C, 0x1E, 0x09, 0x01, 0x08,
+  0x15, 0x09, 0x11, 0x09, 0x32, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x05, 0x01, 0x00,
+  0x01, 0x0A, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x0E, 0x01, 0x0B, 0x04, 0x00, 0x01, 0x02, 0x02, 0x01,
+  0x04, 0x02, 0x02, 0x01, 0x01, 0x02, 0x0E, 0x01, 0x01, 0x0C, 0x02, 0x06, 0x01, 0x00, 0x01, 0x02,
+  0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x04, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x0A, 0x02, 0x0E,
+  0x01, 0x04, 0x01, 0x0C, 0x01, 0x0B, 0x03, 0x01, 0x03, 0x0B, 0x02, 0x0C, 0x01, 0x0B, 0x02, 0x02,
+  0x02, 0x0C, 0x03, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x01, 0x02, 0x02, 0x0B, 0x01, 0x01, 0x01, 0x02,
+  0x03, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x04, 0x01, 0x07, 0x01, 0x06, 0x01, 0x01, 0x01, 0x0A,
+  0x1E, 0x09, 0x01, 0x08, 0x15, 0x09, 0x11, 0x09, 0x32, 0x08, 0x0D, 0x09, 0x01, 0x0E, 0x01, 0x0A,
+  0x01, 0x02, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x0E, 0x02, 0x04, 0x01, 0x05, 0x02, 0x00, 0x01, 0x01,
+  0x01, 0x0B, 0x01, 0x01, 0x01, 0x02, 0x01, 0x05, 0x04, 0x02, 0x03, 0x01, 0x01, 0x02, 0x0A, 0x01,
+  0x01, 0x00, 0x02, 0x02, 0x01, 0x0B, 0x01, 0x04, 0x01, 0x07, 0x01, 0x00, 0x01, 0x01, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x04,
+  0x01, 0x07, 0x01, 0x0A, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0A, 0x03, 0x0B, 0x02, 0x0C, 0x01, 0x0B,
+  0x01, 0x0C, 0x01, 0x02, 0x04, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02,
+  0x02, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x01,
+  0x01, 0x0A, 0x1E, 0x09, 0x01, 0x08, 0x15, 0x09, 0x11, 0x09, 0x32, 0x08, 0x0D, 0x09, 0x01, 0x0F,
+  0x01, 0x04, 0x01, 0x02, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x0F, 0x02, 0x04, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x0B, 0x01, 0x0A, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x02, 0x0C, 0x01,
+  0x01, 0x00, 0x02, 0x01, 0x01, 0x0B, 0x01, 0x04, 0x01, 0x07, 0x01, 0x00, 0x01, 0x01, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x0F, 0x01, 0x04,
+  0x01, 0x07, 0x01, 0x0C, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x0A, 0x01, 0x02, 0x03, 0x0B,
+  0x01, 0x0C, 0x05, 0x0B, 0x01, 0x0C, 0x02, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x01, 0x01, 0x02, 0x0B,
+  0x03, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x01, 0x01, 0x0A,
+  0x0E, 0x09, 0x11, 0x08, 0x15, 0x09, 0x50, 0x09, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x05, 0x01, 0x00,
+  0x01, 0x0A, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x0B,
+  0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02, 0x07, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x00,
+  0x04, 0x01, 0x01, 0x02, 0x02, 0x07, 0x01, 0x00, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09,
+  0x01, 0x0A, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x04, 0x02, 0x0B,
+  0x01, 0x02, 0x01, 0x0B, 0x01, 0x02, 0x02, 0x0B, 0x01, 0x0A, 0x02, 0x0B, 0x03, 0x0C, 0x02, 0x0B,
+  0x01, 0x02, 0x01, 0x0C, 0x01, 0x01, 0x02, 0x0B, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01,
+  0x01, 0x0B, 0x01, 0x01, 0x01, 0x04, 0x01, 0x07, 0x01, 0x06, 0x01, 0x01, 0x01, 0x0A, 0x34, 0x09,
+  0x50, 0x09, 0x01, 0x04, 0x01, 0x0A, 0x01, 0x02, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x0E, 0x02, 0x04,
+  0x01, 0x02, 0x01, 0x05, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x01, 0x02, 0x06, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x0B, 0x01, 0x04, 0x01, 0x07, 0x01, 0x00, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x08,
+  0x0D, 0x09, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04, 0x01, 0x0B, 0x01, 0x0C,
+  0x01, 0x0A, 0x04, 0x0B, 0x01, 0x0C, 0x02, 0x0B, 0x01, 0x0C, 0x05, 0x0B, 0x03, 0x02, 0x02, 0x0B,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x01,
+  0x01, 0x0A, 0x34, 0x09, 0x04, 0x09, 0x4C, 0x08, 0x01, 0x04, 0x01, 0x0C, 0x01, 0x02, 0x01, 0x00,
+  0x01, 0x0B, 0x01, 0x0E, 0x02, 0x04, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x00, 0x02, 0x01,
+  0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0x00, 0x03, 0x01,
+  0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0A, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x0B, 0x01, 0x0E, 0x02, 0x04, 0x01, 0x0C, 0x08, 0x0B, 0x01, 0x0C, 0x02, 0x0B,
+  0x05, 0x02, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x02, 0x02, 0x02, 0x01, 0x01, 0x0B, 0x01, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01,
+  0x01, 0x0A, 0x34, 0x09, 0x04, 0x09, 0x4C, 0x08, 0x01, 0x0E, 0x01, 0x0C, 0x01, 0x02, 0x01, 0x00,
+  0x01, 0x0A, 0x01, 0x04, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x01, 0x1A, 0x00, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0C,
+  0x02, 0x00, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x0B, 0x01, 0x00, 0x15, 0x01,
+  0x01, 0x00, 0x06, 0x01, 0x01, 0x04, 0x01, 0x07, 0x01, 0x05, 0x01, 0x01, 0x01, 0x0C, 0x34, 0x09,
+  0x04, 0x09, 0x4C, 0x08, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x06,
+  0x02, 0x04, 0x01, 0x01, 0x01, 0x0B, 0x02, 0x04, 0x02, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x02, 0x00,
+  0x02, 0x01, 0x01, 0x0B, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0A, 0x04, 0x0D, 0x01, 0x0E,
+  0x03, 0x04, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x06, 0x02, 0x00, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0C, 0x02, 0x00, 0x01, 0x0B, 0x01, 0x0E, 0x02, 0x04, 0x01, 0x02,
+  0x01, 0x0B, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x0B, 0x01, 0x0D, 0x03, 0x01, 0x02, 0x0D, 0x02, 0x01,
+  0x02, 0x00, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x00, 0x06, 0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x0E,
+  0x01, 0x06, 0x01, 0x01, 0x01, 0x0C, 0x34, 0x09, 0x04, 0x09, 0x4C, 0x08, 0x01, 0x0E, 0x01, 0x0C,
+  0x01, 0x0B, 0x01, 0x00, 0x01, 0x02, 0x01, 0x06, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01, 0x01, 0x0C,
+  0x04, 0x0A, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x04, 0x01, 0x0E, 0x02, 0x0A,
+  0x02, 0x02, 0x01, 0x0A, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x08, 0x02, 0x0F, 0x04, 0x0E, 0x02, 0x00,
+  0x01, 0x01, 0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B,
+  0x02, 0x00, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01, 0x01, 0x0A, 0x03, 0x01,
+  0x01, 0x0C, 0x01, 0x0A, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x0F, 0x02, 0x08, 0x04, 0x0F, 0x01, 0x0E, 0x02, 0x0F, 0x01, 0x0A,
+  0x01, 0x00, 0x02, 0x01, 0x02, 0x0E, 0x01, 0x05, 0x01, 0x01, 0x01, 0x0B, 0x34, 0x09, 0x04, 0x09,
+  0x4C, 0x08, 0x02, 0x0A, 0x01, 0x02, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x06, 0x02, 0x04, 0x01, 0x01,
+  0x01, 0x0A, 0x01, 0x04, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0A, 0x02, 0x0B, 0x04, 0x02, 0x01, 0x0B,
+  0x01, 0x02, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x0E, 0x03, 0x04, 0x07, 0x0E, 0x02, 0x00, 0x01, 0x01,
+  0x01, 0x0E, 0x01, 0x07, 0x01, 0x00, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B,
+  0x01, 0x01, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x01, 0x06, 0x0F,
+  0x09, 0x0E, 0x01, 0x0F, 0x03, 0x08, 0x03, 0x0F, 0x02, 0x0E, 0x01, 0x0F, 0x01, 0x0C, 0x01, 0x00,
+  0x02, 0x01, 0x01, 0x04, 0x01, 0x06, 0x01, 0x05, 0x01, 0x00, 0x01, 0x0B, 0x34, 0x09, 0x04, 0x09,
+  0x4C, 0x08, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01,
+  0x02, 0x0A, 0x02, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x02, 0x0A, 0x0A, 0x01, 0x0E, 0x02, 0x00,
+  0x01, 0x02, 0x02, 0x06, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B, 0x02, 0x00,
+  0x01, 0x02, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x04, 0x01, 0x01, 0x01, 0x0F, 0x02, 0x02, 0x02, 0x05,
+  0x01, 0x02, 0x06, 0x01, 0x06, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x0B, 0x01, 0x0E, 0x01, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x02, 0x0E, 0x01, 0x05, 0x01, 0x01, 0x01, 0x0C, 0x34, 0x09, 0x04, 0x09,
+  0x4C, 0x08, 0x01, 0x0A, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x07,
+  0x01, 0x06, 0x01, 0x01, 0x02, 0x0A, 0x02, 0x05, 0x01, 0x02, 0x08, 0x01, 0x02, 0x02, 0x0A, 0x0A,
+  0x01, 0x0E, 0x02, 0x00, 0x01, 0x01, 0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08,
+  0x0D, 0x09, 0x01, 0x0B, 0x02, 0x00, 0x01, 0x02, 0x01, 0x0F, 0x02, 0x06, 0x01, 0x01, 0x01, 0x0E,
+  0x04, 0x05, 0x01, 0x02, 0x09, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x00,
+  0x02, 0x01, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0B, 0x34, 0x09, 0x04, 0x09,
+  0x0C, 0x08, 0x01, 0x0F, 0x3F, 0x08, 0x01, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x01, 0x04, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x03, 0x01, 0x09,
+  0x14, 0x03, 0x02, 0x0E, 0x02, 0x00, 0x01, 0x01, 0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x0E, 0x02, 0x0A,
+  0x01, 0x01, 0x01, 0x0F, 0x01, 0x06, 0x03, 0x0F, 0x02, 0x0E, 0x0B, 0x04, 0x02, 0x06, 0x03, 0x05,
+  0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x0B, 0x34, 0x09, 0x04, 0x09, 0x0B, 0x08, 0x01, 0x0E, 0x02, 0x0F, 0x01, 0x0A,
+  0x01, 0x08, 0x03, 0x0F, 0x01, 0x0A, 0x02, 0x08, 0x01, 0x0F, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x02, 0x0F, 0x05, 0x08,
+  0x02, 0x0E, 0x01, 0x0A, 0x02, 0x0E, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x08, 0x08,
+  0x01, 0x0E, 0x02, 0x08, 0x04, 0x0F, 0x0C, 0x08, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x01, 0x06, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x06, 0x01, 0x03,
+  0x04, 0x09, 0x03, 0x03, 0x03, 0x09, 0x02, 0x03, 0x03, 0x09, 0x02, 0x03, 0x02, 0x09, 0x01, 0x03,
+  0x01, 0x09, 0x01, 0x04, 0x01, 0x0E, 0x02, 0x00, 0x01, 0x02, 0x02, 0x06, 0x02, 0x00, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B, 0x02, 0x00, 0x01, 0x02, 0x01, 0x0E, 0x02, 0x06, 0x01, 0x01,
+  0x01, 0x0F, 0x01, 0x04, 0x15, 0x09, 0x01, 0x03, 0x01, 0x04, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x01, 0x02, 0x02, 0x0E, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0B, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x0A,
+  0x02, 0x0E, 0x03, 0x08, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x09,
+  0x01, 0x08, 0x01, 0x09, 0x01, 0x00, 0x01, 0x04, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x0F,
+  0x04, 0x08, 0x01, 0x0A, 0x0E, 0x09, 0x04, 0x09, 0x0D, 0x08, 0x01, 0x0E, 0x03, 0x0F, 0x01, 0x0E,
+  0x02, 0x0F, 0x02, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x02, 0x0E,
+  0x01, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0F, 0x03, 0x08, 0x02, 0x0A,
+  0x01, 0x0F, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0E, 0x02, 0x08, 0x02, 0x0E, 0x02, 0x08,
+  0x01, 0x0A, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0E, 0x01, 0x08, 0x01, 0x0E, 0x0E, 0x08, 0x01, 0x0A, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01,
+  0x01, 0x04, 0x02, 0x06, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x06, 0x16, 0x03, 0x01, 0x0A, 0x01, 0x0B,
+  0x03, 0x00, 0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B,
+  0x02, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x07,
+  0x01, 0x03, 0x03, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x03, 0x09, 0x01, 0x03, 0x03, 0x09,
+  0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x02, 0x09, 0x01, 0x03, 0x01, 0x04,
+  0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x07, 0x01, 0x00, 0x01, 0x01,
+  0x01, 0x0B, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x09, 0x01, 0x0B, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x04,
+  0x01, 0x01, 0x01, 0x04, 0x01, 0x0B, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x04, 0x01, 0x0B, 0x01, 0x0F,
+  0x01, 0x09, 0x01, 0x00, 0x01, 0x0E, 0x01, 0x0C, 0x01, 0x0F, 0x01, 0x0B, 0x01, 0x04, 0x02, 0x0A,
+  0x01, 0x0C, 0x01, 0x00, 0x01, 0x0A, 0x0E, 0x09, 0x04, 0x09, 0x0C, 0x08, 0x01, 0x0E, 0x03, 0x08,
+  0x01, 0x0F, 0x09, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x02, 0x08,
+  0x01, 0x0E, 0x07, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x04, 0x08, 0x01, 0x0F, 0x0B, 0x08,
+  0x01, 0x0E, 0x0F, 0x08, 0x01, 0x0A, 0x02, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x05,
+  0x01, 0x0C, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x06, 0x03, 0x03, 0x05, 0x09, 0x04, 0x03, 0x02, 0x09,
+  0x02, 0x03, 0x02, 0x09, 0x03, 0x03, 0x01, 0x09, 0x01, 0x04, 0x01, 0x01, 0x03, 0x00, 0x02, 0x04,
+  0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0A,
+  0x01, 0x0F, 0x01, 0x02, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x09, 0x01, 0x03,
+  0x05, 0x09, 0x01, 0x03, 0x08, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x02, 0x03,
+  0x01, 0x04, 0x02, 0x00, 0x02, 0x01, 0x01, 0x07, 0x01, 0x06, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0B,
+  0x0C, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x00,
+  0x01, 0x0B, 0x02, 0x0F, 0x01, 0x0C, 0x01, 0x08, 0x01, 0x00, 0x02, 0x09, 0x01, 0x04, 0x01, 0x09,
+  0x01, 0x0E, 0x01, 0x02, 0x03, 0x0F, 0x01, 0x0E, 0x01, 0x0C, 0x01, 0x0B, 0x01, 0x0E, 0x0E, 0x09,
+  0x04, 0x09, 0x4C, 0x08, 0x01, 0x0A, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x04, 0x02, 0x06,
+  0x01, 0x00, 0x01, 0x0C, 0x01, 0x06, 0x07, 0x03, 0x02, 0x09, 0x04, 0x03, 0x01, 0x09, 0x03, 0x03,
+  0x01, 0x09, 0x03, 0x03, 0x01, 0x09, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00, 0x02, 0x06, 0x02, 0x00,
+  0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B, 0x02, 0x00, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x06,
+  0x01, 0x04, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03,
+  0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x03, 0x09, 0x01, 0x03,
+  0x04, 0x09, 0x01, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x01, 0x0E,
+  0x01, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x09, 0x05, 0x08, 0x01, 0x09, 0x01, 0x0F,
+  0x01, 0x09, 0x04, 0x08, 0x01, 0x0F, 0x01, 0x09, 0x0C, 0x08, 0x0E, 0x09, 0x04, 0x09, 0x13, 0x08,
+  0x02, 0x0F, 0x0C, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x04, 0x08, 0x02, 0x0F, 0x03, 0x08,
+  0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x1C, 0x08, 0x01, 0x0A, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01,
+  0x01, 0x04, 0x01, 0x06, 0x01, 0x05, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x06, 0x01, 0x03, 0x01, 0x09,
+  0x05, 0x03, 0x02, 0x09, 0x06, 0x03, 0x02, 0x09, 0x05, 0x03, 0x02, 0x04, 0x03, 0x00, 0x02, 0x06,
+  0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B, 0x02, 0x00, 0x01, 0x0B, 0x01, 0x0E,
+  0x01, 0x06, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03,
+  0x01, 0x09, 0x03, 0x03, 0x02, 0x09, 0x02, 0x03, 0x02, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03,
+  0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0B,
+  0x01, 0x0E, 0x01, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01, 0x0B, 0x1E, 0x09, 0x01, 0x08, 0x15, 0x09,
+  0x04, 0x09, 0x09, 0x08, 0x01, 0x0F, 0x02, 0x08, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0F,
+  0x02, 0x0A, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x0F, 0x03, 0x0A, 0x02, 0x0E, 0x01, 0x0F, 0x01, 0x0E,
+  0x01, 0x0F, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x06, 0x08,
+  0x01, 0x0A, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x03, 0x0A, 0x01, 0x0F,
+  0x01, 0x0A, 0x02, 0x08, 0x01, 0x0F, 0x03, 0x08, 0x01, 0x0E, 0x02, 0x0F, 0x01, 0x0A, 0x01, 0x0E,
+  0x01, 0x0C, 0x01, 0x0A, 0x0A, 0x08, 0x01, 0x0A, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0E,
+  0x01, 0x02, 0x01, 0x05, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x06, 0x01, 0x03, 0x03, 0x09, 0x06, 0x03,
+  0x02, 0x09, 0x04, 0x03, 0x01, 0x09, 0x03, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x04, 0x01, 0x0A,
+  0x03, 0x00, 0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x02, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x0E,
+  0x01, 0x04, 0x02, 0x09, 0x03, 0x03, 0x01, 0x09, 0x03, 0x03, 0x01, 0x09, 0x03, 0x03, 0x02, 0x09,
+  0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x03, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x02,
+  0x02, 0x06, 0x02, 0x00, 0x01, 0x0B, 0x08, 0x09, 0x02, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x08,
+  0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0A, 0x02, 0x0E, 0x01, 0x09, 0x02, 0x0E, 0x01, 0x0F,
+  0x01, 0x08, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x0A,
+  0x01, 0x0E, 0x02, 0x08, 0x01, 0x09, 0x02, 0x08, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0E,
+  0x02, 0x0F, 0x09, 0x09, 0x04, 0x09, 0x09, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0A, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x0F, 0x03, 0x08, 0x01, 0x0B,
+  0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0E, 0x02, 0x08, 0x01, 0x0E, 0x01, 0x0A,
+  0x01, 0x0F, 0x01, 0x0E, 0x05, 0x08, 0x01, 0x0A, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x0A, 0x01, 0x0F,
+  0x01, 0x0E, 0x01, 0x08, 0x01, 0x0A, 0x02, 0x08, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0A, 0x03, 0x08, 0x01, 0x0A, 0x02, 0x0F, 0x01, 0x08, 0x03, 0x0F, 0x0A, 0x08, 0x01, 0x0C,
+  0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x04, 0x02, 0x06, 0x01, 0x00, 0x01, 0x0C, 0x01, 0x06,
+  0x01, 0x03, 0x06, 0x09, 0x04, 0x03, 0x02, 0x09, 0x09, 0x03, 0x01, 0x04, 0x01, 0x0A, 0x02, 0x00,
+  0x01, 0x01, 0x02, 0x06, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B, 0x02, 0x00,
+  0x01, 0x01, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x0A, 0x01, 0x0C, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x09,
+  0x01, 0x03, 0x01, 0x09, 0x07, 0x03, 0x01, 0x09, 0x07, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09,
+  0x01, 0x0F, 0x01, 0x04, 0x01, 0x01, 0x02, 0x00, 0x01, 0x02, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x0B, 0x08, 0x09, 0x02, 0x0E, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0A,
+  0x01, 0x08, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x04,
+  0x01, 0x0F, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x09,
+  0x01, 0x04, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x09, 0x02, 0x0F, 0x02, 0x0E, 0x01, 0x0A,
+  0x01, 0x0F, 0x01, 0x0A, 0x0A, 0x09, 0x04, 0x09, 0x10, 0x08, 0x02, 0x0E, 0x3A, 0x08, 0x01, 0x0A,
+  0x01, 0x01, 0x03, 0x00, 0x01, 0x04, 0x01, 0x06, 0x01, 0x05, 0x01, 0x00, 0x01, 0x0B, 0x01, 0x05,
+  0x05, 0x03, 0x03, 0x09, 0x06, 0x03, 0x02, 0x09, 0x03, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x04,
+  0x01, 0x0A, 0x03, 0x00, 0x01, 0x04, 0x01, 0x06, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09,
+  0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0E,
+  0x01, 0x04, 0x01, 0x09, 0x05, 0x03, 0x01, 0x09, 0x0B, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09,
+  0x01, 0x0F, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x07, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x0B, 0x0B, 0x09, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x09,
+  0x02, 0x08, 0x01, 0x09, 0x02, 0x04, 0x01, 0x09, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x09,
+  0x01, 0x08, 0x02, 0x09, 0x02, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x08, 0x01, 0x0F,
+  0x01, 0x08, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x0F, 0x0B, 0x09, 0x04, 0x09, 0x4C, 0x08, 0x01, 0x0C,
+  0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x04, 0x01, 0x02, 0x01, 0x05, 0x01, 0x00, 0x01, 0x0B,
+  0x01, 0x05, 0x07, 0x03, 0x04, 0x09, 0x04, 0x03, 0x02, 0x09, 0x05, 0x03, 0x01, 0x04, 0x01, 0x0C,
+  0x03, 0x00, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x05, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09,
+  0x01, 0x0B, 0x01, 0x00, 0x02, 0x01, 0x01, 0x0E, 0x01, 0x05, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x0E,
+  0x01, 0x04, 0x01, 0x03, 0x01, 0x09, 0x03, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x03, 0x03,
+  0x01, 0x09, 0x04, 0x03, 0x02, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x0E, 0x01, 0x04, 0x02, 0x00,
+  0x01, 0x01, 0x01, 0x0B, 0x02, 0x06, 0x02, 0x00, 0x01, 0x0B, 0x34, 0x09, 0x04, 0x09, 0x03, 0x08,
+  0x01, 0x0F, 0x06, 0x08, 0x01, 0x0F, 0x02, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x04, 0x08,
+  0x01, 0x0A, 0x02, 0x0F, 0x08, 0x08, 0x01, 0x0F, 0x01, 0x0A, 0x03, 0x0F, 0x01, 0x0E, 0x02, 0x0F,
+  0x03, 0x08, 0x01, 0x0F, 0x09, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F,
+  0x03, 0x08, 0x02, 0x0F, 0x02, 0x08, 0x01, 0x0A, 0x03, 0x08, 0x01, 0x0F, 0x02, 0x08, 0x01, 0x0A,
+  0x01, 0x08, 0x01, 0x0E, 0x02, 0x08, 0x01, 0x0A, 0x01, 0x02, 0x03, 0x00, 0x01, 0x04, 0x01, 0x06,
+  0x01, 0x05, 0x01, 0x00, 0x01, 0x0C, 0x01, 0x05, 0x09, 0x03, 0x04, 0x09, 0x05, 0x03, 0x01, 0x09,
+  0x03, 0x03, 0x01, 0x04, 0x01, 0x0C, 0x03, 0x00, 0x01, 0x04, 0x01, 0x06, 0x02, 0x00, 0x0A, 0x09,
+  0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x0A,
+  0x01, 0x01, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x03, 0x01, 0x09, 0x03, 0x03, 0x01, 0x09, 0x0D, 0x03,
+  0x02, 0x09, 0x01, 0x0E, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x0B, 0x02, 0x04, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x0C, 0x04, 0x09, 0x01, 0x0E, 0x07, 0x09, 0x01, 0x08, 0x05, 0x09, 0x01, 0x0E, 0x01, 0x09,
+  0x01, 0x08, 0x01, 0x09, 0x01, 0x0F, 0x04, 0x09, 0x01, 0x08, 0x01, 0x0F, 0x03, 0x09, 0x01, 0x08,
+  0x03, 0x09, 0x01, 0x08, 0x02, 0x0F, 0x05, 0x09, 0x01, 0x08, 0x07, 0x09, 0x04, 0x09, 0x02, 0x08,
+  0x01, 0x0E, 0x01, 0x0F, 0x02, 0x0A, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0F, 0x01, 0x08, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0A, 0x02, 0x0F, 0x01, 0x08, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E,
+  0x01, 0x0F, 0x01, 0x08, 0x04, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x0E,
+  0x01, 0x0A, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x0E, 0x02, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x0E,
+  0x01, 0x08, 0x01, 0x0F, 0x02, 0x0A, 0x01, 0x08, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x0A, 0x01, 0x0F,
+  0x01, 0x0A, 0x01, 0x08, 0x01, 0x0A, 0x02, 0x08, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x0F,
+  0x01, 0x0E, 0x02, 0x0F, 0x01, 0x0E, 0x02, 0x0F, 0x02, 0x08, 0x01, 0x0C, 0x01, 0x01, 0x03, 0x00,
+  0x01, 0x04, 0x01, 0x06, 0x01, 0x05, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x02, 0x01, 0x03, 0x02, 0x09,
+  0x0A, 0x03, 0x01, 0x09, 0x05, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x04, 0x01, 0x0B, 0x03, 0x00,
+  0x01, 0x04, 0x01, 0x06, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x01, 0x02, 0x00,
+  0x01, 0x01, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x09,
+  0x0A, 0x03, 0x01, 0x09, 0x07, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x0F, 0x01, 0x0A, 0x03, 0x00,
+  0x01, 0x02, 0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x01, 0x0B, 0x04, 0x09, 0x01, 0x0A, 0x01, 0x04,
+  0x01, 0x0A, 0x03, 0x0E, 0x01, 0x0A, 0x01, 0x08, 0x02, 0x0E, 0x01, 0x0B, 0x02, 0x0F, 0x01, 0x09,
+  0x01, 0x04, 0x01, 0x0E, 0x01, 0x04, 0x02, 0x0A, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0F,
+  0x01, 0x04, 0x03, 0x0E, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0E, 0x02, 0x09, 0x01, 0x01,
+  0x02, 0x09, 0x01, 0x0E, 0x01, 0x04, 0x02, 0x0E, 0x01, 0x0F, 0x01, 0x0B, 0x01, 0x0F, 0x05, 0x09,
+  0x04, 0x09, 0x02, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x02, 0x0F, 0x02, 0x08, 0x01, 0x0A, 0x01, 0x08,
+  0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x02, 0x08, 0x01, 0x0F, 0x02, 0x0E, 0x01, 0x08,
+  0x01, 0x0F, 0x03, 0x08, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0A, 0x04, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0E, 0x05, 0x08, 0x03, 0x0F, 0x04, 0x08,
+  0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E,
+  0x01, 0x0F, 0x01, 0x0A, 0x04, 0x08, 0x05, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F,
+  0x02, 0x08, 0x01, 0x0C, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x04, 0x02, 0x02, 0x01, 0x00,
+  0x01, 0x0A, 0x01, 0x02, 0x08, 0x09, 0x06, 0x03, 0x03, 0x09, 0x05, 0x03, 0x01, 0x04, 0x01, 0x0B,
+  0x03, 0x00, 0x01, 0x0E, 0x01, 0x04, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B,
+  0x01, 0x00, 0x02, 0x01, 0x01, 0x0E, 0x01, 0x05, 0x01, 0x0B, 0x01, 0x01, 0x02, 0x04, 0x01, 0x09,
+  0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x03, 0x03, 0x02, 0x09, 0x06, 0x03, 0x01, 0x09,
+  0x01, 0x03, 0x02, 0x09, 0x01, 0x03, 0x01, 0x0F, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x0A, 0x01, 0x06,
+  0x01, 0x07, 0x02, 0x00, 0x01, 0x0B, 0x03, 0x09, 0x01, 0x0F, 0x01, 0x08, 0x02, 0x0E, 0x01, 0x0F,
+  0x01, 0x0E, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x0A, 0x02, 0x04, 0x01, 0x08,
+  0x02, 0x09, 0x01, 0x04, 0x04, 0x0E, 0x01, 0x04, 0x01, 0x0E, 0x02, 0x04, 0x02, 0x0F, 0x01, 0x04,
+  0x01, 0x09, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0E,
+  0x01, 0x09, 0x01, 0x04, 0x01, 0x0A, 0x01, 0x04, 0x04, 0x0E, 0x05, 0x09, 0x04, 0x09, 0x11, 0x08,
+  0x01, 0x0F, 0x33, 0x08, 0x01, 0x0F, 0x06, 0x08, 0x01, 0x0C, 0x04, 0x00, 0x01, 0x04, 0x02, 0x06,
+  0x01, 0x00, 0x01, 0x0A, 0x01, 0x02, 0x03, 0x03, 0x07, 0x09, 0x06, 0x03, 0x03, 0x09, 0x03, 0x03,
+  0x01, 0x04, 0x01, 0x0B, 0x03, 0x00, 0x02, 0x06, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0C, 0x09,
+  0x01, 0x08, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0F, 0x01, 0x06, 0x01, 0x0C, 0x01, 0x00,
+  0x01, 0x04, 0x01, 0x0E, 0x0A, 0x03, 0x01, 0x09, 0x04, 0x03, 0x01, 0x09, 0x04, 0x03, 0x01, 0x09,
+  0x01, 0x0F, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x0B, 0x01, 0x04, 0x01, 0x07, 0x01, 0x00, 0x01, 0x01,
+  0x01, 0x02, 0x08, 0x09, 0x01, 0x08, 0x01, 0x0E, 0x13, 0x09, 0x01, 0x08, 0x16, 0x09, 0x04, 0x09,
+  0x4C, 0x08, 0x01, 0x0B, 0x04, 0x00, 0x01, 0x04, 0x01, 0x05, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0A,
+  0x01, 0x01, 0x08, 0x03, 0x04, 0x09, 0x06, 0x03, 0x02, 0x09, 0x02, 0x03, 0x01, 0x04, 0x01, 0x0B,
+  0x03, 0x00, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09,
+  0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x04,
+  0x01, 0x0E, 0x01, 0x03, 0x01, 0x09, 0x08, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x04, 0x03,
+  0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x0E, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x0B, 0x01, 0x04,
+  0x01, 0x07, 0x02, 0x00, 0x01, 0x0B, 0x34, 0x09, 0x04, 0x09, 0x4C, 0x08, 0x01, 0x0B, 0x01, 0x01,
+  0x02, 0x00, 0x01, 0x02, 0x01, 0x04, 0x02, 0x02, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x01, 0x0F, 0x03,
+  0x01, 0x09, 0x06, 0x03, 0x01, 0x04, 0x01, 0x0C, 0x03, 0x00, 0x01, 0x04, 0x01, 0x07, 0x01, 0x05,
+  0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x0B, 0x02, 0x00, 0x01, 0x0A, 0x01, 0x0E,
+  0x01, 0x06, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04, 0x03, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09,
+  0x03, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x04, 0x03, 0x01, 0x09, 0x01, 0x03, 0x02, 0x09,
+  0x01, 0x0E, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x0A, 0x01, 0x06, 0x01, 0x07, 0x02, 0x00, 0x01, 0x0B,
+  0x04, 0x09, 0x01, 0x0E, 0x03, 0x0F, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x09, 0x03, 0x0F, 0x01, 0x09,
+  0x01, 0x0F, 0x01, 0x09, 0x01, 0x04, 0x01, 0x08, 0x03, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x0E, 0x01, 0x0F, 0x01, 0x04, 0x02, 0x08, 0x01, 0x09, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x09,
+  0x01, 0x08, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x02, 0x08,
+  0x01, 0x0F, 0x01, 0x08, 0x05, 0x09, 0x04, 0x09, 0x4C, 0x08, 0x01, 0x0C, 0x01, 0x01, 0x03, 0x00,
+  0x01, 0x04, 0x01, 0x06, 0x01, 0x05, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x01, 0x04, 0x03, 0x01, 0x09,
+  0x0A, 0x03, 0x02, 0x09, 0x01, 0x03, 0x01, 0x09, 0x03, 0x03, 0x01, 0x04, 0x01, 0x0C, 0x03, 0x00,
+  0x01, 0x07, 0x01, 0x05, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x02, 0x02, 0x00,
+  0x01, 0x0B, 0x01, 0x0F, 0x01, 0x06, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x07, 0x01, 0x09,
+  0x01, 0x03, 0x01, 0x09, 0x06, 0x03, 0x01, 0x09, 0x06, 0x03, 0x02, 0x09, 0x01, 0x03, 0x01, 0x09,
+  0x01, 0x03, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x0B, 0x01, 0x04, 0x01, 0x07, 0x01, 0x00,
+  0x01, 0x01, 0x01, 0x0B, 0x04, 0x09, 0x01, 0x0C, 0x01, 0x04, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E,
+  0x01, 0x08, 0x01, 0x0A, 0x01, 0x08, 0x02, 0x0E, 0x01, 0x04, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x09,
+  0x01, 0x0F, 0x02, 0x04, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x09, 0x01, 0x01, 0x01, 0x09,
+  0x01, 0x04, 0x02, 0x0F, 0x01, 0x04, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x02, 0x09,
+  0x01, 0x04, 0x02, 0x09, 0x01, 0x0E, 0x01, 0x04, 0x02, 0x0E, 0x01, 0x0F, 0x01, 0x04, 0x01, 0x0F,
+  0x05, 0x09, 0x04, 0x09, 0x4C, 0x08, 0x01, 0x0B, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x04,
+  0x01, 0x05, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x01, 0x0A, 0x09, 0x09, 0x03, 0x01, 0x09,
+  0x02, 0x03, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x04, 0x01, 0x06, 0x01, 0x05, 0x01, 0x00,
+  0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x0E, 0x01, 0x06,
+  0x01, 0x01, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03,
+  0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03,
+  0x02, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x02, 0x09, 0x01, 0x03, 0x01, 0x04, 0x01, 0x0A,
+  0x03, 0x00, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x01, 0x02, 0x05, 0x09, 0x03, 0x08,
+  0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x03, 0x0F, 0x03, 0x09, 0x01, 0x0F,
+  0x01, 0x08, 0x02, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x0F, 0x02, 0x08,
+  0x01, 0x0E, 0x01, 0x09, 0x03, 0x08, 0x02, 0x09, 0x01, 0x08, 0x02, 0x09, 0x04, 0x0F, 0x01, 0x08,
+  0x01, 0x0F, 0x01, 0x08, 0x05, 0x09, 0x04, 0x09, 0x4C, 0x08, 0x02, 0x01, 0x02, 0x00, 0x01, 0x01,
+  0x01, 0x0E, 0x02, 0x01, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x01, 0x02, 0x09, 0x03, 0x03, 0x01, 0x09,
+  0x01, 0x03, 0x07, 0x09, 0x08, 0x03, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x04, 0x01, 0x07,
+  0x01, 0x06, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0C, 0x09, 0x01, 0x08, 0x01, 0x02, 0x02, 0x00,
+  0x01, 0x0A, 0x01, 0x0E, 0x01, 0x05, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0E, 0x06, 0x03,
+  0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x02, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03,
+  0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00,
+  0x01, 0x0A, 0x02, 0x06, 0x02, 0x00, 0x01, 0x02, 0x09, 0x09, 0x01, 0x0F, 0x13, 0x09, 0x01, 0x08,
+  0x16, 0x09, 0x04, 0x09, 0x4C, 0x08, 0x02, 0x01, 0x03, 0x00, 0x01, 0x04, 0x01, 0x06, 0x01, 0x05,
+  0x01, 0x00, 0x01, 0x0C, 0x01, 0x01, 0x16, 0x03, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x06,
+  0x01, 0x05, 0x02, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x01, 0x02, 0x00, 0x01, 0x0C,
+  0x01, 0x0E, 0x01, 0x06, 0x03, 0x0B, 0x04, 0x03, 0x01, 0x09, 0x04, 0x03, 0x01, 0x09, 0x01, 0x03,
+  0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x01, 0x03, 0x02, 0x09, 0x01, 0x03,
+  0x01, 0x09, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x0B, 0x01, 0x04, 0x01, 0x07, 0x02, 0x00,
+  0x01, 0x02, 0x04, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x08, 0x01, 0x09, 0x01, 0x08, 0x06, 0x09,
+  0x01, 0x08, 0x09, 0x09, 0x01, 0x0E, 0x01, 0x0F, 0x0D, 0x09, 0x04, 0x09, 0x4C, 0x08, 0x02, 0x01,
+  0x03, 0x00, 0x01, 0x04, 0x01, 0x01, 0x02, 0x00, 0x01, 0x0A, 0x01, 0x01, 0x16, 0x03, 0x02, 0x04,
+  0x03, 0x00, 0x01, 0x06, 0x01, 0x04, 0x01, 0x05, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09,
+  0x01, 0x01, 0x02, 0x00, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x02,
+  0x01, 0x0E, 0x05, 0x03, 0x01, 0x09, 0x01, 0x03, 0x01, 0x09, 0x04, 0x03, 0x01, 0x09, 0x01, 0x03,
+  0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00,
+  0x01, 0x0A, 0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x01, 0x02, 0x04, 0x09, 0x04, 0x0E, 0x02, 0x0F,
+  0x01, 0x0E, 0x01, 0x09, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x09, 0x01, 0x04,
+  0x01, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x03, 0x0F, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x04,
+  0x01, 0x0F, 0x01, 0x08, 0x01, 0x09, 0x01, 0x08, 0x02, 0x0E, 0x02, 0x09, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x09, 0x02, 0x0F, 0x01, 0x0E, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x05, 0x09, 0x50, 0x09,
+  0x01, 0x01, 0x03, 0x00, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x01,
+  0x16, 0x03, 0x02, 0x04, 0x03, 0x00, 0x02, 0x04, 0x01, 0x06, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08,
+  0x0C, 0x09, 0x01, 0x08, 0x01, 0x01, 0x02, 0x00, 0x01, 0x0A, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01,
+  0x01, 0x0B, 0x01, 0x02, 0x01, 0x0E, 0x0B, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x04, 0x03,
+  0x01, 0x09, 0x01, 0x03, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x0A, 0x01, 0x06, 0x01, 0x07,
+  0x02, 0x00, 0x01, 0x02, 0x04, 0x09, 0x02, 0x04, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x04, 0x01, 0x08,
+  0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x09,
+  0x01, 0x08, 0x01, 0x0C, 0x02, 0x0E, 0x02, 0x04, 0x01, 0x09, 0x01, 0x02, 0x01, 0x08, 0x02, 0x0E,
+  0x01, 0x08, 0x01, 0x0A, 0x01, 0x09, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x09, 0x01, 0x08,
+  0x01, 0x0E, 0x02, 0x09, 0x03, 0x04, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x0F, 0x05, 0x09,
+  0x50, 0x09, 0x02, 0x01, 0x03, 0x00, 0x01, 0x0E, 0x01, 0x05, 0x01, 0x02, 0x01, 0x00, 0x01, 0x0A,
+  0x01, 0x01, 0x06, 0x03, 0x03, 0x09, 0x03, 0x03, 0x02, 0x09, 0x08, 0x03, 0x02, 0x04, 0x03, 0x00,
+  0x01, 0x05, 0x03, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x01, 0x05, 0x01, 0x0E, 0x01, 0x06, 0x03, 0x02, 0x01, 0x0E, 0x0B, 0x03, 0x01, 0x09, 0x01, 0x03,
+  0x01, 0x09, 0x02, 0x03, 0x01, 0x09, 0x04, 0x03, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x0C,
+  0x01, 0x04, 0x01, 0x07, 0x02, 0x00, 0x01, 0x01, 0x08, 0x09, 0x01, 0x0F, 0x01, 0x04, 0x02, 0x08,
+  0x02, 0x09, 0x02, 0x08, 0x05, 0x09, 0x01, 0x0F, 0x02, 0x09, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x08,
+  0x02, 0x09, 0x01, 0x08, 0x01, 0x0F, 0x06, 0x09, 0x01, 0x08, 0x02, 0x09, 0x02, 0x08, 0x03, 0x09,
+  0x01, 0x08, 0x06, 0x09, 0x50, 0x09, 0x01, 0x00, 0x01, 0x01, 0x03, 0x00, 0x01, 0x04, 0x03, 0x00,
+  0x01, 0x0A, 0x01, 0x05, 0x02, 0x03, 0x01, 0x09, 0x13, 0x03, 0x02, 0x04, 0x03, 0x00, 0x01, 0x0A,
+  0x01, 0x04, 0x01, 0x05, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x01, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x0E, 0x01, 0x05, 0x01, 0x01, 0x02, 0x02, 0x01, 0x0E, 0x0D, 0x03, 0x01, 0x09,
+  0x04, 0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x04, 0x01, 0x0A, 0x03, 0x00, 0x01, 0x0A, 0x01, 0x04,
+  0x01, 0x07, 0x02, 0x00, 0x01, 0x01, 0x34, 0x09, 0x50, 0x09, 0x05, 0x00, 0x01, 0x04, 0x02, 0x01,
+  0x01, 0x00, 0x02, 0x05, 0x16, 0x03, 0x02, 0x04, 0x03, 0x00, 0x01, 0x06, 0x01, 0x07, 0x01, 0x06,
+  0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0C, 0x09, 0x01, 0x08, 0x01, 0x01, 0x02, 0x00, 0x01, 0x05,
+  0x01, 0x06, 0x01, 0x05, 0x01, 0x00, 0x01, 0x02, 0x01, 0x05, 0x16, 0x03, 0x01, 0x06, 0x01, 0x04,
+  0x03, 0x00, 0x01, 0x04, 0x02, 0x06, 0x02, 0x00, 0x01, 0x01, 0x12, 0x09, 0x01, 0x04, 0x01, 0x09,
+  0x03, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x09, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x08, 0x16, 0x09,
+  0x50, 0x09, 0x05, 0x00, 0x01, 0x04, 0x01, 0x05, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0A, 0x01, 0x05,
+  0x16, 0x03, 0x02, 0x04, 0x03, 0x00, 0x01, 0x02, 0x02, 0x05, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08,
+  0x0D, 0x09, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x05, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01,
+  0x01, 0x02, 0x01, 0x05, 0x16, 0x03, 0x01, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x0C, 0x02, 0x07,
+  0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x12, 0x09, 0x02, 0x0E, 0x01, 0x04, 0x01, 0x0E, 0x01, 0x0A,
+  0x01, 0x04, 0x01, 0x09, 0x01, 0x01, 0x01, 0x09, 0x02, 0x0E, 0x01, 0x0F, 0x01, 0x0E, 0x15, 0x09,
+  0x50, 0x09, 0x05, 0x00, 0x01, 0x06, 0x03, 0x00, 0x02, 0x06, 0x08, 0x03, 0x01, 0x09, 0x0D, 0x03,
+  0x02, 0x04, 0x03, 0x00, 0x01, 0x05, 0x02, 0x07, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09,
+  0x03, 0x00, 0x01, 0x05, 0x01, 0x04, 0x01, 0x05, 0x01, 0x01, 0x02, 0x05, 0x16, 0x03, 0x01, 0x06,
+  0x01, 0x04, 0x03, 0x00, 0x01, 0x04, 0x02, 0x07, 0x02, 0x00, 0x01, 0x01, 0x13, 0x09, 0x01, 0x04,
+  0x06, 0x0F, 0x01, 0x0E, 0x02, 0x0F, 0x01, 0x08, 0x01, 0x0A, 0x15, 0x09, 0x50, 0x09, 0x05, 0x00,
+  0x01, 0x04, 0x01, 0x05, 0x01, 0x02, 0x01, 0x00, 0x02, 0x06, 0x16, 0x03, 0x02, 0x04, 0x03, 0x00,
+  0x03, 0x06, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09, 0x02, 0x00, 0x01, 0x01, 0x01, 0x06,
+  0x02, 0x05, 0x01, 0x00, 0x02, 0x05, 0x16, 0x03, 0x01, 0x06, 0x01, 0x04, 0x03, 0x00, 0x01, 0x04,
+  0x02, 0x06, 0x02, 0x00, 0x01, 0x01, 0x1D, 0x09, 0x01, 0x08, 0x16, 0x09, 0x50, 0x09, 0x05, 0x00,
+  0x01, 0x04, 0x01, 0x05, 0x01, 0x01, 0x01, 0x00, 0x02, 0x06, 0x16, 0x03, 0x01, 0x04, 0x01, 0x0A,
+  0x03, 0x00, 0x01, 0x02, 0x02, 0x05, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0C, 0x09, 0x01, 0x08,
+  0x02, 0x00, 0x01, 0x01, 0x01, 0x06, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01, 0x02, 0x05, 0x16, 0x03,
+  0x01, 0x06, 0x01, 0x04, 0x03, 0x00, 0x01, 0x0A, 0x02, 0x07, 0x02, 0x00, 0x01, 0x01, 0x0A, 0x09,
+  0x01, 0x08, 0x29, 0x09, 0x50, 0x09, 0x05, 0x00, 0x01, 0x04, 0x01, 0x01, 0x02, 0x00, 0x02, 0x06,
+  0x16, 0x03, 0x01, 0x04, 0x01, 0x05, 0x03, 0x00, 0x01, 0x05, 0x01, 0x07, 0x01, 0x06, 0x01, 0x00,
+  0x0A, 0x09, 0x01, 0x08, 0x0C, 0x09, 0x01, 0x08, 0x03, 0x00, 0x02, 0x04, 0x01, 0x06, 0x01, 0x01,
+  0x01, 0x06, 0x01, 0x05, 0x16, 0x03, 0x01, 0x06, 0x01, 0x04, 0x03, 0x00, 0x01, 0x04, 0x01, 0x07,
+  0x01, 0x06, 0x01, 0x00, 0x02, 0x01, 0x0A, 0x09, 0x01, 0x0E, 0x04, 0x0F, 0x01, 0x0E, 0x02, 0x0F,
+  0x01, 0x09, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x09,
+  0x01, 0x04, 0x03, 0x0F, 0x01, 0x08, 0x01, 0x09, 0x01, 0x08, 0x02, 0x0F, 0x01, 0x0E, 0x01, 0x08,
+  0x01, 0x0F, 0x01, 0x08, 0x02, 0x0F, 0x0B, 0x09, 0x50, 0x09, 0x05, 0x00, 0x01, 0x04, 0x01, 0x05,
+  0x01, 0x01, 0x01, 0x00, 0x01, 0x06, 0x01, 0x05, 0x03, 0x07, 0x02, 0x06, 0x0E, 0x05, 0x03, 0x06,
+  0x02, 0x05, 0x03, 0x00, 0x01, 0x05, 0x02, 0x06, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0C, 0x09,
+  0x01, 0x08, 0x03, 0x00, 0x02, 0x06, 0x01, 0x05, 0x01, 0x00, 0x04, 0x04, 0x07, 0x06, 0x01, 0x05,
+  0x03, 0x06, 0x07, 0x07, 0x02, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x03, 0x06,
+  0x01, 0x00, 0x02, 0x01, 0x0A, 0x09, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x0E,
+  0x02, 0x0F, 0x02, 0x0E, 0x01, 0x0F, 0x01, 0x0A, 0x02, 0x0F, 0x02, 0x0E, 0x01, 0x09, 0x01, 0x0F,
+  0x01, 0x0E, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x04,
+  0x01, 0x0E, 0x01, 0x0A, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x09, 0x01, 0x0F, 0x0B, 0x09, 0x50, 0x09,
+  0x05, 0x00, 0x01, 0x04, 0x01, 0x06, 0x01, 0x01, 0x01, 0x00, 0x05, 0x04, 0x02, 0x06, 0x0C, 0x05,
+  0x03, 0x0A, 0x04, 0x04, 0x03, 0x00, 0x01, 0x02, 0x02, 0x06, 0x01, 0x00, 0x0A, 0x09, 0x01, 0x08,
+  0x0C, 0x09, 0x01, 0x08, 0x04, 0x00, 0x02, 0x05, 0x01, 0x00, 0x02, 0x04, 0x01, 0x06, 0x03, 0x05,
+  0x03, 0x0A, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x04, 0x01, 0x0E, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+  0x01, 0x05, 0x02, 0x07, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x0A, 0x09, 0x02, 0x0F, 0x01, 0x09,
+  0x01, 0x08, 0x01, 0x0E, 0x01, 0x09, 0x03, 0x0F, 0x01, 0x09, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x08,
+  0x01, 0x0E, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0F, 0x02, 0x08, 0x01, 0x0E, 0x01, 0x09, 0x01, 0x08,
+  0x01, 0x09, 0x01, 0x0E, 0x03, 0x08, 0x01, 0x0E, 0x01, 0x08, 0x01, 0x0E, 0x0C, 0x09, 0x50, 0x09,
+  0x09, 0x00, 0x01, 0x05, 0x01, 0x02, 0x17, 0x00, 0x02, 0x01, 0x06, 0x00, 0x0A, 0x09, 0x01, 0x08,
+  0x0C, 0x09, 0x01, 0x08, 0x07, 0x00, 0x05, 0x01, 0x0A, 0x00, 0x02, 0x01, 0x02, 0x00, 0x03, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x05, 0x07, 0x00, 0x02, 0x01, 0x34, 0x09, 0x50, 0x09,
+  0x2A, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0C, 0x09, 0x01, 0x08, 0x08, 0x01, 0x02, 0x00, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x06, 0x00, 0x01, 0x01, 0x10, 0x00, 0x03, 0x01,
+  0x0F, 0x09, 0x01, 0x0F, 0x01, 0x04, 0x01, 0x0F, 0x09, 0x09, 0x01, 0x08, 0x18, 0x09, 0x50, 0x09,
+  0x2A, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0C, 0x09, 0x01, 0x08, 0x06, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x02, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x02, 0x04, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
+  0x03, 0x01, 0x10, 0x09, 0x01, 0x0E, 0x01, 0x0F, 0x03, 0x04, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x0F,
+  0x01, 0x09, 0x01, 0x0B, 0x01, 0x0E, 0x01, 0x0F, 0x02, 0x0E, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x0E,
+  0x01, 0x0C, 0x01, 0x04, 0x11, 0x09, 0x50, 0x09, 0x08, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x03, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x02, 0x00, 0x04, 0x01,
+  0x01, 0x00, 0x04, 0x01, 0x02, 0x00, 0x02, 0x01, 0x05, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0D, 0x09,
+  0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x08, 0x01, 0x01, 0x02, 0x03, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x05, 0x01, 0x01, 0x03, 0x02, 0x04, 0x01,
+  0x01, 0x05, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x04, 0x01, 0x10, 0x09, 0x01, 0x0E, 0x01, 0x0F,
+  0x01, 0x0E, 0x01, 0x0F, 0x01, 0x08, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x08, 0x01, 0x09, 0x02, 0x04,
+  0x01, 0x0E, 0x01, 0x0C, 0x01, 0x04, 0x01, 0x0E, 0x02, 0x0F, 0x01, 0x0A, 0x01, 0x04, 0x11, 0x09,
+  0x50, 0x09, 0x07, 0x00, 0x02, 0x01, 0x17, 0x00, 0x01, 0x01, 0x04, 0x00, 0x01, 0x01, 0x04, 0x00,
+  0x0A, 0x09, 0x01, 0x08, 0x0C, 0x09, 0x01, 0x08, 0x05, 0x00, 0x03, 0x01, 0x03, 0x00, 0x01, 0x01,
+  0x06, 0x00, 0x02, 0x01, 0x09, 0x00, 0x03, 0x01, 0x02, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00,
+  0x03, 0x01, 0x01, 0x00, 0x01, 0x01, 0x21, 0x09, 0x01, 0x0F, 0x12, 0x09, 0x50, 0x09, 0x07, 0x00,
+  0x01, 0x01, 0x1A, 0x00, 0x01, 0x02, 0x07, 0x00, 0x0A, 0x09, 0x01, 0x08, 0x0C, 0x09, 0x01, 0x08,
+  0x06, 0x00, 0x01, 0x04, 0x01, 0x0E, 0x01, 0x0A, 0x01, 0x00, 0x01, 0x01, 0x12, 0x00, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x0E, 0x01, 0x01, 0x08, 0x00, 0x01, 0x01, 0x34, 0x09, 0x50, 0x09, 0x08, 0x00,
+  0x02, 0x04, 0x01, 0x02, 0x17, 0x00, 0x01, 0x04, 0x01, 0x05, 0x06, 0x00, 0x0A, 0x09, 0x01, 0x08,
+  0x0C, 0x09, 0x01, 0x08, 0x06, 0x00, 0x01, 0x0E, 0x02, 0x0F, 0x16, 0x00, 0x01, 0x04, 0x01, 0x0C,
+  0x08, 0x00, 0x01, 0x01, 0x34, 0x09, 0x50, 0x09, 0x08, 0x00, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x04,
+  0x17, 0x00, 0x03, 0x04, 0x05, 0x00, 0x01, 0x08, 0x09, 0x09, 0x01, 0x08, 0x0C, 0x09, 0x01, 0x08,
+  0x06, 0x00, 0x01, 0x04, 0x01, 0x0E, 0x01, 0x0A, 0x15, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x0F,
+  0x01, 0x0E, 0x07, 0x00, 0x01, 0x01, 0x34, 0x09, 0x50, 0x09, 0x08, 0x00, 0x01, 0x04, 0x01, 0x0A,
+  0x01, 0x04, 0x17, 0x00, 0x01, 0x0A, 0x02, 0x0E, 0x01, 0x01, 0x04, 0x00, 0x0A, 0x09, 0x01, 0x08,
+  0x0C, 0x09, 0x01, 0x08, 0x07, 0x00, 0x01, 0x01, 0x16, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x04,
+  0x01, 0x0E, 0x07, 0x00, 0x01, 0x01, 0x34, 0x09, 0x50, 0x09, 0x09, 0x00, 0x01, 0x02, 0x18, 0x00,
+  0x01, 0x02, 0x01, 0x0A, 0x01, 0x04, 0x05, 0x00, 0x01, 0x08, 0x09, 0x09, 0x01, 0x08, 0x0C, 0x09,
+  0x01, 0x08, 0x08, 0x00, 0x01, 0x01, 0x05, 0x00, 0x01, 0x01, 0x10, 0x00, 0x01, 0x02, 0x01, 0x0A,
+  0x01, 0x01, 0x07, 0x00, 0x01, 0x01, 0x34, 0x09, 0x50, 0x09, 0x2A, 0x00, 0x0A, 0x09, 0x01, 0x08,
+  0x0C, 0x09, 0x01, 0x08, 0x0D, 0x00, 0x01, 0x01, 0x06, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x0E, 0x00, 0x01, 0x01, 0x34, 0x09, 0xF0, 0x09,
+  0xF0, 0x09, 0xF0, 0x09, 0x63, 0x09, 0x01, 0x08, 0x02, 0x09, 0x01, 0x08, 0x3E, 0x09, 0x01, 0x08,
+  0x01, 0x0F, 0x01, 0x09, 0x01, 0x08, 0x47, 0x09, 0x63, 0x09, 0x02, 0x0F, 0x01, 0x0B, 0x02, 0x08,
+  0x3D, 0x09, 0x01, 0x0F, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x0F, 0x47, 0x09, 0x63, 0x09, 0x02, 0x0F,
+  0x01, 0x0E, 0x02, 0x08, 0x3D, 0x09, 0x01, 0x0F, 0x01, 0x0E, 0x02, 0x0F, 0x47, 0x09, 0x63, 0x09,
+  0x01, 0x08, 0x02, 0x09, 0x01, 0x08, 0x3E, 0x09, 0x01, 0x08, 0x02, 0x09, 0x01, 0x08, 0x47, 0x09,
+  0xF0, 0x09, 0xF0, 0x09, 0xF0, 0x09, 0xF0, 0x09, 0xF0, 0x09, 0xF0, 0x09,
+};
+
+const sBITMAP Bitmap_splash = {
+  Bitmap_splash_Data,
+  Bitmap_splash_Palette,
+  240, /* Width */
+  120, /* Height */
+  16, /* Colors */
+  BITMAP_FORMAT_RLE8,
+};
@@ -0,0 +1,17 @@
+/* Generated by tools/pack_bitmaps.py, do not edit */
+#ifndef __BITMAP_PACK_H
+#define __BITMAP_PACK_H
+
+#include "bitmaps.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+extern const sBITMAP Bitmap_splash;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BITMAP_PACK_H */
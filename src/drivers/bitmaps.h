@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file    bitmaps.h
+  * @brief   Palette bitmaps drawn by BSP_LCD_DrawPackedBitmap(), as generated
+  *          by tools/pack_bitmaps.py into bitmap_pack.c
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __BITMAPS_H
+#define __BITMAPS_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/** @defgroup BITMAPS_Exported_Types
+  * @{
+  */
+typedef struct _tBitmap
+{
+  const uint8_t *data;
+  const uint32_t *palette;  /* ARGB8888 colour per palette index */
+  uint16_t Width;
+  uint16_t Height;
+  uint16_t Colors;          /* Entries in palette, 1 to 256 */
+  uint8_t format;           /* BITMAP_FORMAT_x layout of data */
+
+} sBITMAP;
+/**
+  * @}
+  */
+
+/** @defgroup BITMAPS_Exported_Constants
+  * @{
+  */
+/* Pixel layouts: 8 or 4 bit palette indices (two pixels per byte, the
+   first in the low nibble, rows padded to whole bytes beyond Width) that
+   the DMA2D CLUT expands, or per row runs of (count, index) byte pairs */
+#define BITMAP_FORMAT_L8        0
+#define BITMAP_FORMAT_L4        1
+#define BITMAP_FORMAT_RLE8      2
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BITMAPS_H */
@@ -0,0 +1,101 @@
+/**
+  ******************************************************************************
+  * @file    ellipse.h
+  * @brief   The ellipse walk shared by BSP_LCD_DrawEllipse() and
+  *          BSP_LCD_FillEllipse(), and the box it stays within
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __ELLIPSE_H
+#define __ELLIPSE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/** @defgroup ELLIPSE_Exported_Types
+  * @{
+  */
+typedef struct
+{
+  int x;        /* Walk position, x runs up to the larger radius */
+  int y;        /* From -YRadius up to 0 */
+  int err;
+  float K;      /* YRadius / XRadius, x is scaled down by it */
+} EllipseWalkTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup ELLIPSE_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Starts a walk over one quadrant of an ellipse.
+  * @param  Walk: walk state
+  * @param  XRadius: ellipse X radius
+  * @param  YRadius: ellipse Y radius
+  */
+static inline void EllipseBegin(EllipseWalkTypeDef *Walk, int XRadius, int YRadius)
+{
+  Walk->x = 0;
+  Walk->y = -YRadius;
+  Walk->err = 2 - 2*XRadius;
+  Walk->K = (float)YRadius / (float)XRadius;
+}
+
+/**
+  * @brief  Gives the next point of the quadrant, mirrored by the callers.
+  * @param  Walk: walk state
+  * @param  Dx: X offset of the point from the centre, 0 or more
+  * @param  Dy: Y offset of the point from the centre, 0 or less
+  * @retval 0 once the quadrant is done, with no point given
+  */
+static inline uint8_t EllipseNext(EllipseWalkTypeDef *Walk, int *Dx, int *Dy)
+{
+  int e2;
+
+  if (Walk->y > 0)
+  {
+    return 0;
+  }
+  *Dx = (int)(Walk->x / Walk->K);
+  *Dy = Walk->y;
+
+  e2 = Walk->err;
+  if (e2 <= Walk->x)
+  {
+    Walk->err += ++Walk->x*2+1;
+    if (-Walk->y == Walk->x && e2 <= Walk->y) e2 = 0;
+  }
+  if (e2 > Walk->y) Walk->err += ++Walk->y*2+1;
+  return 1;
+}
+
+/**
+  * @brief  Half width of the box the walk stays within.
+  * @note   x runs up to the larger of the two radii, not to XRadius, before
+  *         it is scaled down; one more pixel covers the rounding.
+  * @param  XRadius: ellipse X radius
+  * @param  YRadius: ellipse Y radius
+  */
+static inline int EllipseHalfWidth(int XRadius, int YRadius)
+{
+  int larger = XRadius > YRadius ? XRadius : YRadius;
+
+  return (int)(larger * (float)XRadius / (float)YRadius) + 1;
+}
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ELLIPSE_H */
@@ -0,0 +1,1027 @@
+/* Generated by tools/subset_font.py, do not edit */
+#include "font_subset.h"
+
+static const uint8_t Font16Subset_Table[] = {
+  /* ' ' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '+' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x04, 0x00,
+  0x04, 0x00,
+  0x04, 0x00,
+  0x3F, 0x80,
+  0x04, 0x00,
+  0x04, 0x00,
+  0x04, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '-' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x3F, 0x80,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '.' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '/' */
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x06, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '0' */
+  0x00, 0x00,
+  0x0E, 0x00,
+  0x1B, 0x00,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x1B, 0x00,
+  0x0E, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '1' */
+  0x00, 0x00,
+  0x06, 0x00,
+  0x3E, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x3F, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '2' */
+  0x00, 0x00,
+  0x0F, 0x00,
+  0x19, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x03, 0x00,
+  0x06, 0x00,
+  0x0C, 0x00,
+  0x18, 0x00,
+  0x30, 0x00,
+  0x3F, 0x80,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '3' */
+  0x00, 0x00,
+  0x3F, 0x00,
+  0x61, 0x80,
+  0x01, 0x80,
+  0x03, 0x00,
+  0x1F, 0x00,
+  0x03, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x61, 0x80,
+  0x3F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '4' */
+  0x00, 0x00,
+  0x07, 0x00,
+  0x07, 0x00,
+  0x0F, 0x00,
+  0x0B, 0x00,
+  0x1B, 0x00,
+  0x13, 0x00,
+  0x33, 0x00,
+  0x3F, 0x80,
+  0x03, 0x00,
+  0x0F, 0x80,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '5' */
+  0x00, 0x00,
+  0x1F, 0x80,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x1F, 0x00,
+  0x11, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x21, 0x80,
+  0x1F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '6' */
+  0x00, 0x00,
+  0x07, 0x80,
+  0x1C, 0x00,
+  0x18, 0x00,
+  0x30, 0x00,
+  0x37, 0x00,
+  0x39, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x19, 0x80,
+  0x0F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '7' */
+  0x00, 0x00,
+  0x7F, 0x00,
+  0x43, 0x00,
+  0x03, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '8' */
+  0x00, 0x00,
+  0x1F, 0x00,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x1F, 0x00,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x1F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '9' */
+  0x00, 0x00,
+  0x1E, 0x00,
+  0x33, 0x00,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x33, 0x80,
+  0x1D, 0x80,
+  0x01, 0x80,
+  0x03, 0x00,
+  0x07, 0x00,
+  0x3C, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* ':' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'A' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x3F, 0x00,
+  0x0F, 0x00,
+  0x09, 0x00,
+  0x19, 0x80,
+  0x19, 0x80,
+  0x1F, 0x80,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x79, 0xE0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'B' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7F, 0x00,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x3F, 0x00,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x7F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x1F, 0x40,
+  0x30, 0xC0,
+  0x60, 0x40,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x60, 0x40,
+  0x30, 0x80,
+  0x1F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7F, 0x00,
+  0x31, 0x80,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x31, 0x80,
+  0x7F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7F, 0x80,
+  0x30, 0x80,
+  0x30, 0x80,
+  0x32, 0x00,
+  0x3E, 0x00,
+  0x32, 0x00,
+  0x30, 0x80,
+  0x30, 0x80,
+  0x7F, 0x80,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7F, 0xC0,
+  0x30, 0x40,
+  0x30, 0x40,
+  0x32, 0x00,
+  0x3E, 0x00,
+  0x32, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x7C, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x1E, 0x80,
+  0x31, 0x80,
+  0x60, 0x80,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x67, 0xC0,
+  0x61, 0x80,
+  0x31, 0x80,
+  0x1F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x3F, 0xC0,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x3F, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7E, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x40,
+  0x18, 0x40,
+  0x18, 0x40,
+  0x7F, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'M' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0xE0, 0xE0,
+  0x60, 0xC0,
+  0x71, 0xC0,
+  0x7B, 0xC0,
+  0x6A, 0xC0,
+  0x6E, 0xC0,
+  0x64, 0xC0,
+  0x60, 0xC0,
+  0xFB, 0xE0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x1F, 0x00,
+  0x31, 0x80,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0x31, 0x80,
+  0x1F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7F, 0x00,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x3F, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x7E, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7F, 0x00,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x3E, 0x00,
+  0x33, 0x00,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x7C, 0xE0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'S' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x1F, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x38, 0x00,
+  0x1F, 0x00,
+  0x03, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x3F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7F, 0x80,
+  0x4C, 0x80,
+  0x4C, 0x80,
+  0x4C, 0x80,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x3F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7B, 0xC0,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x1F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'W' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0xFB, 0xE0,
+  0x60, 0xC0,
+  0x64, 0xC0,
+  0x6E, 0xC0,
+  0x6E, 0xC0,
+  0x2A, 0x80,
+  0x3B, 0x80,
+  0x3B, 0x80,
+  0x31, 0x80,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x3F, 0x80,
+  0x21, 0x80,
+  0x23, 0x00,
+  0x06, 0x00,
+  0x04, 0x00,
+  0x0C, 0x00,
+  0x18, 0x80,
+  0x30, 0x80,
+  0x3F, 0x80,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* '_' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0xFF, 0xE0,
+  /* 'a' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x1F, 0x00,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x1F, 0x80,
+  0x31, 0x80,
+  0x33, 0x80,
+  0x1D, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00,
+  0x70, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x37, 0x00,
+  0x39, 0x80,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x39, 0x80,
+  0x77, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x1E, 0x80,
+  0x31, 0x80,
+  0x60, 0x80,
+  0x60, 0x00,
+  0x60, 0x80,
+  0x31, 0x80,
+  0x1F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00,
+  0x03, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x1D, 0x80,
+  0x33, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x33, 0x80,
+  0x1D, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x1F, 0x00,
+  0x31, 0x80,
+  0x60, 0xC0,
+  0x7F, 0xC0,
+  0x60, 0x00,
+  0x30, 0xC0,
+  0x1F, 0x80,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00,
+  0x07, 0xE0,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x3F, 0x80,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x3F, 0x80,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x1D, 0xC0,
+  0x33, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x33, 0x80,
+  0x1D, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x1F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00,
+  0x70, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x37, 0x00,
+  0x39, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x7B, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'i' */
+  0x00, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x00, 0x00,
+  0x1E, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x3F, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00,
+  0x70, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x37, 0x80,
+  0x36, 0x00,
+  0x3C, 0x00,
+  0x3C, 0x00,
+  0x36, 0x00,
+  0x33, 0x00,
+  0x77, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00,
+  0x1E, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x3F, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7F, 0x80,
+  0x36, 0xC0,
+  0x36, 0xC0,
+  0x36, 0xC0,
+  0x36, 0xC0,
+  0x36, 0xC0,
+  0x76, 0xE0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x77, 0x00,
+  0x39, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x7B, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x1F, 0x00,
+  0x31, 0x80,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0x31, 0x80,
+  0x1F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x77, 0x00,
+  0x39, 0x80,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x39, 0x80,
+  0x37, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x7C, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7B, 0x80,
+  0x1C, 0xC0,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x7F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 's' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x1F, 0x80,
+  0x31, 0x80,
+  0x3C, 0x00,
+  0x1F, 0x00,
+  0x03, 0x80,
+  0x31, 0x80,
+  0x3F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 't' */
+  0x00, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x7F, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x80,
+  0x0F, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x73, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x33, 0x80,
+  0x1D, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7B, 0xC0,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x1B, 0x00,
+  0x1B, 0x00,
+  0x0E, 0x00,
+  0x0E, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0xF1, 0xE0,
+  0x60, 0xC0,
+  0x64, 0xC0,
+  0x6E, 0xC0,
+  0x3B, 0x80,
+  0x3B, 0x80,
+  0x31, 0x80,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7B, 0xC0,
+  0x1B, 0x00,
+  0x0E, 0x00,
+  0x0E, 0x00,
+  0x0E, 0x00,
+  0x1B, 0x00,
+  0x7B, 0xC0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x79, 0xE0,
+  0x30, 0xC0,
+  0x19, 0x80,
+  0x19, 0x80,
+  0x0B, 0x00,
+  0x0F, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x0C, 0x00,
+  0x3E, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x3F, 0x80,
+  0x21, 0x80,
+  0x03, 0x00,
+  0x0E, 0x00,
+  0x18, 0x00,
+  0x30, 0x80,
+  0x3F, 0x80,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+};
+
+static const uint8_t Font16Subset_Map[] = {  /* from ' ', 0xFF = FONT_GLYPH_MISSING */
+  0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 1,
+  0xFF, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+  13, 14, 15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 16, 17, 18,
+  19, 20, 21, 22, 0xFF, 23, 0xFF, 0xFF, 24, 25, 0xFF, 26,
+  27, 0xFF, 28, 29, 30, 31, 0xFF, 32, 0xFF, 0xFF, 33, 0xFF,
+  0xFF, 0xFF, 0xFF, 34, 0xFF, 35, 36, 37, 38, 39, 40, 41,
+  42, 43, 0xFF, 44, 45, 46, 47, 48, 49, 0xFF, 50, 51,
+  52, 53, 54, 55, 56, 57, 58, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+sFONT Font16Subset = {
+  (const uint8_t *)Font16Subset_Table,
+  11, /* Width */
+  16, /* Height */
+  Font16Subset_Map,
+  FONT_FORMAT_BITS,
+};
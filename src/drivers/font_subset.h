@@ -0,0 +1,20 @@
+/* Generated by tools/subset_font.py, do not edit */
+#ifndef __FONT_SUBSET_H
+#define __FONT_SUBSET_H
+
+#include "fonts.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+extern sFONT Font16Subset;
+
+/* Characters held by the subset fonts */
+#define FONT_SUBSET_CHARS " +-./0123456789:ABCDEFGILMOPRSTUWZ_abcdefghiklmnoprstuvwxyz"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FONT_SUBSET_H */
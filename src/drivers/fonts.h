@@ -70,6 +70,8 @@ typedef struct _tFont
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const uint8_t *map;  /* Glyph index per character from ' ', NULL for a full ASCII table */
+  uint8_t format;      /* FONT_FORMAT_x layout of the glyphs in table */
   
 } sFONT;
 
@@ -87,6 +89,18 @@ extern sFONT Font8;
   */ 
 #define LINE(x) ((x) * (((sFONT *)BSP_LCD_GetFont())->Height))
 
+/* Glyph layouts: packed 1 bit per pixel rows as in fontXX.c, pre-expanded
+   to ARGB8888 pixels that are copied to the frame buffer as they are, or
+   8 or 4 bit coverage masks (two pixels per byte, the first in the low
+   nibble) that DMA2D blends in the text colour */
+#define FONT_FORMAT_BITS        0
+#define FONT_FORMAT_ARGB8888    1
+#define FONT_FORMAT_A8          2
+#define FONT_FORMAT_A4          3
+
+/* map entry of a character the font does not hold */
+#define FONT_GLYPH_MISSING      0xFF
+
 /**
   * @}
   */ 
@@ -74,6 +74,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f429i_discovery_lcd.h"
 #include "fonts.h"
+#include "ellipse.h"
 //#include "font24.c"
 //#include "font20.c"
 //#include "font16.c"
@@ -96,6 +97,19 @@
 /** @defgroup STM32F429I_DISCOVERY_LCD_Private_TypesDefinitions STM32F429I DISCOVERY LCD Private TypesDefinitions
   * @{
   */ 
+/* Polygon edge crossing a run of scanlines, sampled at pixel centres. Its
+   x on the current scanline, less half a pixel, is the fixed-point value
+   X + Error / Denominator with 0 <= Error < Denominator, stepped exactly */
+typedef struct
+{
+  int32_t X;            /* integer part */
+  int32_t Error;        /* fraction, in 1 / Denominator */
+  int32_t Denominator;  /* twice the edge's height */
+  int32_t Step;         /* x step from one scanline to the next ... */
+  int32_t StepError;    /* ... and its fraction */
+  int16_t YStart;       /* first scanline crossed */
+  int16_t YEnd;         /* scanline after the last one crossed */
+} PolyEdgeTypeDef;
 /**
   * @}
   */ 
@@ -105,6 +119,17 @@
   */
 #define POLY_X(Z)              ((int32_t)((Points + Z)->X))
 #define POLY_Y(Z)              ((int32_t)((Points + Z)->Y))
+/* Most vertices BSP_LCD_FillPolygon takes */
+#ifndef POLY_MAX_EDGES
+#define POLY_MAX_EDGES         32
+#endif
+/* Spans shorter than this are written by the CPU: setting up a DMA2D
+   transfer costs more than writing a few pixels */
+#define SPAN_DMA_MIN_LENGTH    16
+/* Visibility of a primitive's bounding box, see ClipBox */
+#define CLIP_OUTSIDE           0
+#define CLIP_PARTIAL           1
+#define CLIP_INSIDE            2
 /**
   * @}
   */ 
@@ -113,6 +138,8 @@
   * @{
   */
 #define ABS(X)  ((X) > 0 ? (X) : -(X))
+#define MIN(A, B)  ((A) < (B) ? (A) : (B))
+#define MAX(A, B)  ((A) > (B) ? (A) : (B))
 /**
   * @}
   */ 
@@ -128,6 +155,20 @@ static RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct;
 static uint32_t ActiveLayer = 0;
 static LCD_DrawPropTypeDef DrawProp[MAX_LAYER_NUMBER];
 LCD_DrvTypeDef  *LcdDrv;
+
+/* Active layer frame buffer and size, latched by ClipBox per primitive */
+static uint32_t *CanvasBuffer;
+static int32_t CanvasWidth;
+static int32_t CanvasHeight;
+
+/* Run of horizontal spans sharing one DMA2D setup */
+static uint32_t SpanColor = 0;
+static uint8_t SpanDma = 0;
+static uint8_t SpanPending = 0;
+
+/* Edge table of BSP_LCD_FillPolygon, and its active edges */
+static PolyEdgeTypeDef PolyEdges[POLY_MAX_EDGES];
+static uint8_t PolyActive[POLY_MAX_EDGES];
 /**
   * @}
   */ 
@@ -136,8 +177,21 @@ LCD_DrvTypeDef  *LcdDrv;
   * @{
   */ 
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
+static void CopyChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
+static void BlendChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c, uint32_t ColorMode);
 static void FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
 static void ConvertLineToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode);
+static uint8_t ClipBox(int32_t X1, int32_t Y1, int32_t X2, int32_t Y2);
+static void FillRegion(int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height);
+static void PlotPixel(int32_t Xpos, int32_t Ypos, uint32_t Color, uint8_t Clip);
+static void FillColumn(int32_t Xpos, int32_t Ypos, int32_t Length, uint8_t Clip);
+static void SpanBegin(uint32_t Color);
+static void SpanFill(int32_t Xpos, int32_t Ypos, int32_t Length, uint8_t Clip);
+static void SpanEnd(void);
+static void PolyEdgeSet(PolyEdgeTypeDef *Edge, int64_t Numerator);
+static uint8_t PolyEdgeBefore(const PolyEdgeTypeDef *A, const PolyEdgeTypeDef *B);
+static void BlendPixel(int32_t Xpos, int32_t Ypos, uint32_t Color, uint32_t Alpha, uint8_t Clip);
+static uint32_t ISqrt(uint32_t Value);
 /**
   * @}
   */ 
@@ -276,7 +330,7 @@ void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address)
   HAL_LTDC_ConfigLayer(&LtdcHandler, &Layercfg, LayerIndex); 
 
   DrawProp[LayerIndex].BackColor = LCD_COLOR_WHITE;
-  DrawProp[LayerIndex].pFont     = &Font24;
+  DrawProp[LayerIndex].pFont     = &LCD_DEFAULT_FONT;
   DrawProp[LayerIndex].TextColor = LCD_COLOR_BLACK; 
 
   /* Dithering activation */
@@ -594,8 +648,35 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   */
 void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
-              DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  sFONT *font = DrawProp[ActiveLayer].pFont;
+  uint32_t index = Ascii - ' ';
+
+  /* Subset fonts hold only some characters: the others are drawn as a space */
+  if(font->map != NULL)
+  {
+    index = (Ascii < ' ' || Ascii > '~') ? FONT_GLYPH_MISSING : font->map[index];
+    if(index == FONT_GLYPH_MISSING)
+    {
+      index = font->map[0];
+    }
+  }
+
+  if(font->format == FONT_FORMAT_ARGB8888)
+  {
+    CopyChar(Xpos, Ypos, &font->table[index * font->Height * font->Width * 4]);
+  }
+  else if(font->format == FONT_FORMAT_A8)
+  {
+    BlendChar(Xpos, Ypos, &font->table[index * font->Height * font->Width], CM_A8);
+  }
+  else if(font->format == FONT_FORMAT_A4)
+  {
+    BlendChar(Xpos, Ypos, &font->table[index * font->Height * font->Width / 2], CM_A4);
+  }
+  else
+  {
+    DrawChar(Xpos, Ypos, &font->table[index * font->Height * ((font->Width + 7) / 8)]);
+  }
 }
 
 /**
@@ -676,13 +757,7 @@ void BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr)
   */
 void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 {
-  uint32_t xaddress = 0;
-  
-  /* Get the line address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
-
-  /* Write line */
-  FillBuffer(ActiveLayer, (uint32_t *)xaddress, Length, 1, 0, DrawProp[ActiveLayer].TextColor);
+  FillRegion(Xpos, Ypos, Length, 1);
 }
 
 /**
@@ -693,13 +768,7 @@ void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   */
 void BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 {
-  uint32_t xaddress = 0;
-  
-  /* Get the line address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
-  
-  /* Write line */
-  FillBuffer(ActiveLayer, (uint32_t *)xaddress, 1, Length, (BSP_LCD_GetXSize() - 1), DrawProp[ActiveLayer].TextColor);
+  FillRegion(Xpos, Ypos, 1, Length);
 }
 
 /**
@@ -711,68 +780,88 @@ void BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   */
 void BSP_LCD_DrawLine(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
 {
-  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-  yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-  curpixel = 0;
-  
-  deltax = ABS(X2 - X1);        /* The difference between the x's */
-  deltay = ABS(Y2 - Y1);        /* The difference between the y's */
-  x = X1;                       /* Start x off at the first pixel */
-  y = Y1;                       /* Start y off at the first pixel */
-  
-  if (X2 >= X1)                 /* The x-values are increasing */
-  {
-    xinc1 = 1;
-    xinc2 = 1;
-  }
-  else                          /* The x-values are decreasing */
+  int32_t deltax = 0, deltay = 0, x = 0, y = 0, xinc = 0, yinc = 0,
+  majorx = 0, majory = 0, minorx = 0, minory = 0, den = 0, num = 0,
+  numadd = 0, numpixels = 0, curpixel = 0, majorstep = 0, minorstep = 0;
+  uint32_t color = DrawProp[ActiveLayer].TextColor;
+  uint32_t *pixel;
+  uint8_t clip;
+
+  /* Straight lines are a single DMA2D fill */
+  if (Y1 == Y2)
   {
-    xinc1 = -1;
-    xinc2 = -1;
+    FillRegion(MIN(X1, X2), Y1, ABS(X2 - X1) + 1, 1);
+    return;
   }
-  
-  if (Y2 >= Y1)                 /* The y-values are increasing */
+  if (X1 == X2)
   {
-    yinc1 = 1;
-    yinc2 = 1;
+    FillRegion(X1, MIN(Y1, Y2), 1, ABS(Y2 - Y1) + 1);
+    return;
   }
-  else                          /* The y-values are decreasing */
+
+  clip = ClipBox(MIN(X1, X2), MIN(Y1, Y2), MAX(X1, X2), MAX(Y1, Y2));
+  if (clip == CLIP_OUTSIDE)
   {
-    yinc1 = -1;
-    yinc2 = -1;
+    return;
   }
-  
+
+  deltax = ABS(X2 - X1);        /* The difference between the x's */
+  deltay = ABS(Y2 - Y1);        /* The difference between the y's */
+  xinc = (X2 >= X1) ? 1 : -1;   /* Direction of the x-values */
+  yinc = (Y2 >= Y1) ? 1 : -1;   /* Direction of the y-values */
+
   if (deltax >= deltay)         /* There is at least one x-value for every y-value */
   {
-    xinc1 = 0;                  /* Don't change the x when numerator >= denominator */
-    yinc2 = 0;                  /* Don't change the y for every iteration */
+    majorx = xinc;              /* x changes every iteration, y when numerator >= denominator */
+    minory = yinc;
     den = deltax;
-    num = deltax / 2;
     numadd = deltay;
-    numpixels = deltax;         /* There are more x-values than y-values */
+    numpixels = deltax;
   }
   else                          /* There is at least one y-value for every x-value */
   {
-    xinc2 = 0;                  /* Don't change the x for every iteration */
-    yinc1 = 0;                  /* Don't change the y when numerator >= denominator */
+    majory = yinc;              /* y changes every iteration, x when numerator >= denominator */
+    minorx = xinc;
     den = deltay;
-    num = deltay / 2;
     numadd = deltax;
-    numpixels = deltay;         /* There are more y-values than x-values */
+    numpixels = deltay;
   }
-  
+  num = den / 2;
+
+  if (clip == CLIP_INSIDE)
+  {
+    /* Walk the frame buffer: each step is a fixed pointer increment */
+    pixel = CanvasBuffer + Y1 * CanvasWidth + X1;
+    majorstep = majory * CanvasWidth + majorx;
+    minorstep = minory * CanvasWidth + minorx;
+    for (curpixel = 0; curpixel <= numpixels; curpixel++)
+    {
+      *pixel = color;
+      num += numadd;
+      if (num >= den)
+      {
+        num -= den;
+        pixel += minorstep;
+      }
+      pixel += majorstep;
+    }
+    return;
+  }
+
+  x = X1;
+  y = Y1;
   for (curpixel = 0; curpixel <= numpixels; curpixel++)
   {
-    BSP_LCD_DrawPixel(x, y, DrawProp[ActiveLayer].TextColor);   /* Draw the current pixel */
-    num += numadd;                            /* Increase the numerator by the top of the fraction */
-    if (num >= den)                           /* Check if numerator >= denominator */
+    PlotPixel(x, y, color, CLIP_PARTIAL);
+    num += numadd;
+    if (num >= den)
     {
-      num -= den;                             /* Calculate the new numerator value */
-      x += xinc1;                             /* Change the x as appropriate */
-      y += yinc1;                             /* Change the y as appropriate */
+      num -= den;
+      x += minorx;
+      y += minory;
     }
-    x += xinc2;                               /* Change the x as appropriate */
-    y += yinc2;                               /* Change the y as appropriate */
+    x += majorx;
+    y += majory;
   }
 }
 
@@ -785,13 +874,20 @@ void BSP_LCD_DrawLine(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
   */
 void BSP_LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
 {
-  /* Draw horizontal lines */
-  BSP_LCD_DrawHLine(Xpos, Ypos, Width);
-  BSP_LCD_DrawHLine(Xpos, (Ypos+ Height), Width);
-  
-  /* Draw vertical lines */
-  BSP_LCD_DrawVLine(Xpos, Ypos, Height);
-  BSP_LCD_DrawVLine((Xpos + Width), Ypos, Height);
+  uint8_t clip = ClipBox(Xpos, Ypos, Xpos + Width, Ypos + Height);
+
+  if (clip == CLIP_OUTSIDE)
+  {
+    return;
+  }
+
+  /* The CPU draws the sides while DMA2D fills the top and bottom */
+  SpanBegin(DrawProp[ActiveLayer].TextColor);
+  SpanFill(Xpos, Ypos, Width, clip);
+  SpanFill(Xpos, Ypos + Height, Width, clip);
+  FillColumn(Xpos, Ypos, Height, clip);
+  FillColumn(Xpos + Width, Ypos, Height, clip);
+  SpanEnd();
 }
 
 /**
@@ -802,36 +898,69 @@ void BSP_LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Hei
   */
 void BSP_LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 {
-  int32_t  d;/* Decision Variable */ 
-  uint32_t  curx;/* Current X Value */
-  uint32_t  cury;/* Current Y Value */ 
-  
+  int32_t  d;/* Decision Variable */
+  int32_t  curx;/* Current X Value */
+  int32_t  cury;/* Current Y Value */
+  uint32_t color = DrawProp[ActiveLayer].TextColor;
+  uint32_t *top, *bottom, *upper, *lower;
+  uint8_t clip;
+
+  clip = ClipBox(Xpos - Radius, Ypos - Radius, Xpos + Radius, Ypos + Radius);
+  if (clip == CLIP_OUTSIDE)
+  {
+    return;
+  }
+
   d = 3 - (Radius << 1);
   curx = 0;
   cury = Radius;
-  
+
+  /* Rows Ypos -/+ cury and Ypos -/+ curx, stepped a row at a time */
+  top = CanvasBuffer + (Ypos - cury) * CanvasWidth + Xpos;
+  bottom = CanvasBuffer + (Ypos + cury) * CanvasWidth + Xpos;
+  upper = CanvasBuffer + Ypos * CanvasWidth + Xpos;
+  lower = upper;
+
   while (curx <= cury)
   {
-    BSP_LCD_DrawPixel((Xpos + curx), (Ypos - cury), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos - curx), (Ypos - cury), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos + cury), (Ypos - curx), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos - cury), (Ypos - curx), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos + curx), (Ypos + cury), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos - curx), (Ypos + cury), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos + cury), (Ypos + curx), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos - cury), (Ypos + curx), DrawProp[ActiveLayer].TextColor);   
+    if (clip == CLIP_INSIDE)
+    {
+      top[curx] = color;
+      top[-curx] = color;
+      upper[cury] = color;
+      upper[-cury] = color;
+      bottom[curx] = color;
+      bottom[-curx] = color;
+      lower[cury] = color;
+      lower[-cury] = color;
+    }
+    else
+    {
+      PlotPixel(Xpos + curx, Ypos - cury, color, clip);
+      PlotPixel(Xpos - curx, Ypos - cury, color, clip);
+      PlotPixel(Xpos + cury, Ypos - curx, color, clip);
+      PlotPixel(Xpos - cury, Ypos - curx, color, clip);
+      PlotPixel(Xpos + curx, Ypos + cury, color, clip);
+      PlotPixel(Xpos - curx, Ypos + cury, color, clip);
+      PlotPixel(Xpos + cury, Ypos + curx, color, clip);
+      PlotPixel(Xpos - cury, Ypos + curx, color, clip);
+    }
 
     if (d < 0)
-    { 
+    {
       d += (curx << 2) + 6;
     }
     else
     {
       d += ((curx - cury) << 2) + 10;
       cury--;
+      top += CanvasWidth;
+      bottom -= CanvasWidth;
     }
     curx++;
-  } 
+    upper -= CanvasWidth;
+    lower += CanvasWidth;
+  }
 }
 
 /**
@@ -868,28 +997,26 @@ void BSP_LCD_DrawPolygon(pPoint Points, uint16_t PointCount)
   */
 void BSP_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
 {
-  int x = 0, y = -YRadius, err = 2-2*XRadius, e2;
-  float k = 0, rad1 = 0, rad2 = 0;
-  
-  rad1 = XRadius;
-  rad2 = YRadius;
-  
-  k = (float)(rad2/rad1);
-  
-  do { 
-    BSP_LCD_DrawPixel((Xpos-(uint16_t)(x/k)), (Ypos+y), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos+(uint16_t)(x/k)), (Ypos+y), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos+(uint16_t)(x/k)), (Ypos-y), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos-(uint16_t)(x/k)), (Ypos-y), DrawProp[ActiveLayer].TextColor);      
-    
-    e2 = err;
-    if (e2 <= x) {
-      err += ++x*2+1;
-      if (-y == x && e2 <= y) e2 = 0;
-    }
-    if (e2 > y) err += ++y*2+1;
+  EllipseWalkTypeDef walk;
+  int dx, dy;
+  uint32_t color = DrawProp[ActiveLayer].TextColor;
+  uint8_t clip;
+
+  dx = EllipseHalfWidth(XRadius, YRadius);
+  clip = ClipBox(Xpos - dx, Ypos - YRadius, Xpos + dx, Ypos + YRadius);
+  if (clip == CLIP_OUTSIDE)
+  {
+    return;
+  }
+
+  EllipseBegin(&walk, XRadius, YRadius);
+  while (EllipseNext(&walk, &dx, &dy))
+  {
+    PlotPixel(Xpos - dx, Ypos + dy, color, clip);
+    PlotPixel(Xpos + dx, Ypos + dy, color, clip);
+    PlotPixel(Xpos + dx, Ypos - dy, color, clip);
+    PlotPixel(Xpos - dx, Ypos - dy, color, clip);
   }
-  while (y <= 0);
 }
 
 /**
@@ -948,6 +1075,104 @@ void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
   }
 }
 
+/**
+  * @brief  Draws a palette bitmap packed by tools/pack_bitmaps.py.
+  *         L8 and L4 bitmaps fully on screen are expanded by one DMA2D
+  *         transfer through its CLUT; RLE8 runs are filled as spans.
+  * @param  X: the bitmap x position in the LCD
+  * @param  Y: the bitmap Y position in the LCD
+  * @param  pBitmap: the bitmap
+  */
+void BSP_LCD_DrawPackedBitmap(uint32_t X, uint32_t Y, const sBITMAP *pBitmap)
+{
+  const uint8_t *data = pBitmap->data;
+  int32_t width = pBitmap->Width, height = pBitmap->Height;
+  int32_t x, y, run;
+  uint32_t address, index;
+  uint8_t clip;
+  DMA2D_CLUTCfgTypeDef clut;
+
+  clip = ClipBox(X, Y, X + width - 1, Y + height - 1);
+  if ((width <= 0) || (height <= 0) || (clip == CLIP_OUTSIDE))
+  {
+    return;
+  }
+
+  if (pBitmap->format == BITMAP_FORMAT_RLE8)
+  {
+    SpanBegin(pBitmap->palette[0]);
+    for (y = 0; y < height; y++)
+    {
+      for (x = 0; x < width; x += run)
+      {
+        run = data[0];
+        /* Each DMA2D transfer takes its color when it starts */
+        SpanColor = pBitmap->palette[data[1]];
+        SpanFill(X + x, Y + y, run, clip);
+        data += 2;
+      }
+    }
+    SpanEnd();
+    return;
+  }
+
+  if (clip != CLIP_INSIDE)
+  {
+    /* Partly off screen: look the indices up with the CPU */
+    for (y = 0; y < height; y++)
+    {
+      for (x = 0; x < width; x++)
+      {
+        if (pBitmap->format == BITMAP_FORMAT_L4)
+        {
+          index = (data[y * ((width + 1) / 2) + x / 2] >> (4 * (x & 1))) & 0x0F;
+        }
+        else
+        {
+          index = data[y * width + x];
+        }
+        PlotPixel(X + x, Y + y, pBitmap->palette[index], clip);
+      }
+    }
+    return;
+  }
+
+  address = LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + 4*(Y*BSP_LCD_GetXSize() + X);
+
+  /* Memory to memory with pixel format conversion through the CLUT */
+  Dma2dHandler.Init.Mode         = DMA2D_M2M_PFC;
+  Dma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
+  Dma2dHandler.Init.OutputOffset = BSP_LCD_GetXSize() - width;
+
+  Dma2dHandler.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  Dma2dHandler.LayerCfg[1].InputAlpha = 0xFF;
+  Dma2dHandler.LayerCfg[1].InputColorMode = (pBitmap->format == BITMAP_FORMAT_L4) ? CM_L4 : CM_L8;
+  /* Skip the nibble that pads odd L4 rows to whole bytes */
+  Dma2dHandler.LayerCfg[1].InputOffset = (pBitmap->format == BITMAP_FORMAT_L4) ? (width & 1) : 0;
+
+  clut.pCLUT = (uint32_t *)pBitmap->palette;
+  clut.CLUTColorMode = DMA2D_CCM_ARGB8888;
+  clut.Size = pBitmap->Colors - 1;
+
+  Dma2dHandler.Instance = DMA2D;
+
+  /* DMA2D Initialization */
+  if(HAL_DMA2D_Init(&Dma2dHandler) == HAL_OK)
+  {
+    if((HAL_DMA2D_ConfigLayer(&Dma2dHandler, 1) == HAL_OK) &&
+       (HAL_DMA2D_ConfigCLUT(&Dma2dHandler, clut, 1) == HAL_OK) &&
+       (HAL_DMA2D_EnableCLUT(&Dma2dHandler, 1) == HAL_OK))
+    {
+      /* Polling for the CLUT load, then for the transfer */
+      HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
+      if (HAL_DMA2D_Start(&Dma2dHandler, (uint32_t)data, address, width, height) == HAL_OK)
+      {
+        HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
+      }
+    }
+  }
+}
+
 /**
   * @brief  Displays a full rectangle.
   * @param  Xpos: the X position
@@ -957,16 +1182,7 @@ void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
   */
 void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
 {
-  uint32_t xaddress = 0;
-
-  /* Set the text color */
-  BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
-
-  /* Get the rectangle start address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
-
-  /* Fill the rectangle */
-  FillBuffer(ActiveLayer, (uint32_t *)xaddress, Width, Height, (BSP_LCD_GetXSize() - Width), DrawProp[ActiveLayer].TextColor);
+  FillRegion(Xpos, Ypos, Width, Height);
 }
 
 /**
@@ -977,44 +1193,50 @@ void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Hei
   */
 void BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 {
-  int32_t  d;    /* Decision Variable */ 
-  uint32_t  curx;/* Current X Value */
-  uint32_t  cury;/* Current Y Value */ 
-  
+  int32_t  d;    /* Decision Variable */
+  int32_t  curx;/* Current X Value */
+  int32_t  cury;/* Current Y Value */
+  uint8_t clip;
+
+  clip = ClipBox(Xpos - Radius, Ypos - Radius, Xpos + Radius, Ypos + Radius);
+  if (clip == CLIP_OUTSIDE)
+  {
+    return;
+  }
+
   d = 3 - (Radius << 1);
 
   curx = 0;
   cury = Radius;
-  
-  BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
 
+  /* Each row is filled once: rows Ypos -/+ curx as curx steps, and rows
+     Ypos -/+ cury at their widest, just before cury steps */
+  SpanBegin(DrawProp[ActiveLayer].TextColor);
   while (curx <= cury)
   {
-    if(cury > 0) 
+    SpanFill(Xpos - cury, Ypos + curx, 2*cury + 1, clip);
+    if (curx > 0)
     {
-      BSP_LCD_DrawHLine(Xpos - cury, Ypos + curx, 2*cury);
-      BSP_LCD_DrawHLine(Xpos - cury, Ypos - curx, 2*cury);
+      SpanFill(Xpos - cury, Ypos - curx, 2*cury + 1, clip);
     }
 
-    if(curx > 0) 
-    {
-      BSP_LCD_DrawHLine(Xpos - curx, Ypos - cury, 2*curx);
-      BSP_LCD_DrawHLine(Xpos - curx, Ypos + cury, 2*curx);
-    }
     if (d < 0)
-    { 
+    {
       d += (curx << 2) + 6;
     }
     else
     {
+      if (curx != cury)
+      {
+        SpanFill(Xpos - curx, Ypos + cury, 2*curx + 1, clip);
+        SpanFill(Xpos - curx, Ypos - cury, 2*curx + 1, clip);
+      }
       d += ((curx - cury) << 2) + 10;
       cury--;
     }
     curx++;
   }
-
-  BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
-  BSP_LCD_DrawCircle(Xpos, Ypos, Radius);
+  SpanEnd();
 }
 
 /**
@@ -1027,137 +1249,157 @@ void BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
   * @param  Y3: the point 3 y position
   */
 void BSP_LCD_FillTriangle(uint16_t X1, uint16_t X2, uint16_t X3, uint16_t Y1, uint16_t Y2, uint16_t Y3)
-{ 
-  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-  yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-  curpixel = 0;
-  
-  deltax = ABS(X2 - X1);        /* The difference between the x's */
-  deltay = ABS(Y2 - Y1);        /* The difference between the y's */
-  x = X1;                       /* Start x off at the first pixel */
-  y = Y1;                       /* Start y off at the first pixel */
-  
-  if (X2 >= X1)                 /* The x-values are increasing */
-  {
-    xinc1 = 1;
-    xinc2 = 1;
-  }
-  else                          /* The x-values are decreasing */
-  {
-    xinc1 = -1;
-    xinc2 = -1;
-  }
-  
-  if (Y2 >= Y1)                 /* The y-values are increasing */
-  {
-    yinc1 = 1;
-    yinc2 = 1;
-  }
-  else                          /* The y-values are decreasing */
-  {
-    yinc1 = -1;
-    yinc2 = -1;
-  }
-  
-  if (deltax >= deltay)         /* There is at least one x-value for every y-value */
-  {
-    xinc1 = 0;                  /* Don't change the x when numerator >= denominator */
-    yinc2 = 0;                  /* Don't change the y for every iteration */
-    den = deltax;
-    num = deltax / 2;
-    numadd = deltay;
-    numpixels = deltax;         /* There are more x-values than y-values */
-  }
-  else                          /* There is at least one y-value for every x-value */
-  {
-    xinc2 = 0;                  /* Don't change the x for every iteration */
-    yinc1 = 0;                  /* Don't change the y when numerator >= denominator */
-    den = deltay;
-    num = deltay / 2;
-    numadd = deltax;
-    numpixels = deltay;         /* There are more y-values than x-values */
-  }
-  
-  for (curpixel = 0; curpixel <= numpixels; curpixel++)
-  {
-    BSP_LCD_DrawLine(x, y, X3, Y3);
-    
-    num += numadd;              /* Increase the numerator by the top of the fraction */
-    if (num >= den)             /* Check if numerator >= denominator */
-    {
-      num -= den;               /* Calculate the new numerator value */
-      x += xinc1;               /* Change the x as appropriate */
-      y += yinc1;               /* Change the y as appropriate */
-    }
-    x += xinc2;                 /* Change the x as appropriate */
-    y += yinc2;                 /* Change the y as appropriate */
-  } 
+{
+  Point points[3];
+
+  points[0].X = X1;
+  points[0].Y = Y1;
+  points[1].X = X2;
+  points[1].Y = Y2;
+  points[2].X = X3;
+  points[2].Y = Y3;
+
+  BSP_LCD_FillPolygon(points, 3);
 }
 
 /**
   * @brief  Displays a full poly-line (between many points).
   * @param  Points: pointer to the points array
-  * @param  PointCount: Number of points
+  * @param  PointCount: Number of points, at most POLY_MAX_EDGES
+  * @note   Convex, concave and self-intersecting polygons are filled with
+  *         the even-odd rule. A pixel is filled when its centre is inside,
+  *         so polygons sharing an edge do not overlap.
   */
 void BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount)
 {
-  
-  int16_t x = 0, y = 0, x2 = 0, y2 = 0, xcenter = 0, ycenter = 0, xfirst = 0, yfirst = 0, pixelx = 0, pixely = 0, counter = 0;
-  uint16_t  imageleft = 0, imageright = 0, imagetop = 0, imagebottom = 0;  
+  PolyEdgeTypeDef *edge, swap;
+  int32_t x0 = 0, y0 = 0, x1 = 0, y1 = 0, left = 0, right = 0, top = 0, bottom = 0, y = 0;
+  uint16_t count = 0, next = 0, active = 0, kept = 0, counter = 0, i = 0;
+  uint8_t clip, index;
 
-  imageleft = imageright = Points->X;
-  imagetop= imagebottom = Points->Y;
+  if((PointCount < 3) || (PointCount > POLY_MAX_EDGES))
+  {
+    return;
+  }
 
-  for(counter = 1; counter < PointCount; counter++)
+  /* Edge table: every edge that is not horizontal, top end first */
+  left = right = POLY_X(0);
+  top = bottom = POLY_Y(0);
+  for(counter = 0; counter < PointCount; counter++)
   {
-    pixelx = POLY_X(counter);
-    if(pixelx < imageleft)
+    x0 = POLY_X(counter);
+    y0 = POLY_Y(counter);
+    x1 = POLY_X((counter + 1) % PointCount);
+    y1 = POLY_Y((counter + 1) % PointCount);
+
+    left = MIN(left, x0);
+    right = MAX(right, x0);
+    top = MIN(top, y0);
+    bottom = MAX(bottom, y0);
+
+    if(y0 == y1)
     {
-      imageleft = pixelx;
+      continue;
     }
-    if(pixelx > imageright)
+    if(y0 > y1)
     {
-      imageright = pixelx;
+      x0 = x1;
+      x1 = POLY_X(counter);
+      y0 = y1;
+      y1 = POLY_Y(counter);
     }
 
-    pixely = POLY_Y(counter);
-    if(pixely < imagetop)
-    { 
-      imagetop = pixely;
-    }
-    if(pixely > imagebottom)
-    {
-      imagebottom = pixely;
-    }
-  }  
+    /* Over a scanline x moves by (x1 - x0) / (y1 - y0), and the first
+       scanline crossed is y0, sampled at its centre y0 + 1/2 */
+    edge = &PolyEdges[count++];
+    edge->Denominator = 2 * (y1 - y0);
+    PolyEdgeSet(edge, 2 * (x1 - x0));
+    edge->Step = edge->X;
+    edge->StepError = edge->Error;
+    PolyEdgeSet(edge, (int64_t)x0 * edge->Denominator + (x1 - x0) - (y1 - y0));
+    edge->YStart = y0;
+    edge->YEnd = y1;
+  }
 
-  if(PointCount < 2)
+  clip = ClipBox(left, top, right, bottom);
+  if((count == 0) || (clip == CLIP_OUTSIDE))
   {
     return;
   }
 
-  xcenter = (imageleft + imageright)/2;
-  ycenter = (imagebottom + imagetop)/2;
- 
-  xfirst = Points->X;
-  yfirst = Points->Y;
+  /* Sort by first scanline; there are few edges, so insertion sort */
+  for(counter = 1; counter < count; counter++)
+  {
+    swap = PolyEdges[counter];
+    for(i = counter; (i > 0) && (PolyEdges[i - 1].YStart > swap.YStart); i--)
+    {
+      PolyEdges[i] = PolyEdges[i - 1];
+    }
+    PolyEdges[i] = swap;
+  }
 
-  while(--PointCount)
+  /* Only the scanlines on screen */
+  y = MAX(top, 0);
+  bottom = MIN(bottom, CanvasHeight);
+
+  SpanBegin(DrawProp[ActiveLayer].TextColor);
+  for(; (y < bottom) && ((next < count) || (active > 0)); y++)
   {
-    x = Points->X;
-    y = Points->Y;
-    Points++;
-    x2 = Points->X;
-    y2 = Points->Y;    
-  
-    BSP_LCD_FillTriangle(x, x2, xcenter, y, y2, ycenter);
-    BSP_LCD_FillTriangle(x, xcenter, x2, y, ycenter, y2);
-    BSP_LCD_FillTriangle(xcenter, x2, x, ycenter, y2, y);   
+    /* Edges starting here join the active list; above the screen, they
+       are first moved down to this scanline */
+    while((next < count) && (PolyEdges[next].YStart <= y))
+    {
+      edge = &PolyEdges[next];
+      if(edge->YStart < y)
+      {
+        PolyEdgeSet(edge, (int64_t)edge->X * edge->Denominator + edge->Error +
+                    (int64_t)(y - edge->YStart) * ((int64_t)edge->Step * edge->Denominator + edge->StepError));
+      }
+      PolyActive[active++] = next++;
+    }
+
+    /* Drop finished edges and keep the rest sorted by x; they only swap
+       places where the polygon crosses itself */
+    for(counter = 0, kept = 0; counter < active; counter++)
+    {
+      index = PolyActive[counter];
+      if(PolyEdges[index].YEnd <= y)
+      {
+        continue;
+      }
+      for(i = kept; (i > 0) && PolyEdgeBefore(&PolyEdges[index], &PolyEdges[PolyActive[i - 1]]); i--)
+      {
+        PolyActive[i] = PolyActive[i - 1];
+      }
+      PolyActive[i] = index;
+      kept++;
+    }
+    active = kept;
+
+    /* Even-odd: fill between the first and second edge, third and fourth,
+       ... over the pixels whose centres lie in between */
+    for(counter = 0; counter + 1 < active; counter += 2)
+    {
+      edge = &PolyEdges[PolyActive[counter]];
+      x0 = edge->X + (edge->Error > 0);
+      edge = &PolyEdges[PolyActive[counter + 1]];
+      x1 = edge->X + (edge->Error > 0);
+      SpanFill(x0, y, x1 - x0, clip);
+    }
+
+    for(counter = 0; counter < active; counter++)
+    {
+      edge = &PolyEdges[PolyActive[counter]];
+      edge->X += edge->Step;
+      edge->Error += edge->StepError;
+      if(edge->Error >= edge->Denominator)
+      {
+        edge->Error -= edge->Denominator;
+        edge->X++;
+      }
+    }
   }
-  
-  BSP_LCD_FillTriangle(xfirst, x2, xcenter, yfirst, y2, ycenter);
-  BSP_LCD_FillTriangle(xfirst, xcenter, x2, yfirst, ycenter, y2);
-  BSP_LCD_FillTriangle(xcenter, x2, xfirst, ycenter, y2, yfirst);   
+  SpanEnd();
 }
 
 /**
@@ -1169,27 +1411,125 @@ void BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount)
   */
 void BSP_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
 {
-  int x = 0, y = -YRadius, err = 2-2*XRadius, e2;
-  float K = 0, rad1 = 0, rad2 = 0;
-  
-  rad1 = XRadius;
-  rad2 = YRadius;
-  K = (float)(rad2/rad1);
-  
-  do 
-  { 
-    BSP_LCD_DrawHLine((Xpos-(uint16_t)(x/K)), (Ypos+y), (2*(uint16_t)(x/K) + 1));
-    BSP_LCD_DrawHLine((Xpos-(uint16_t)(x/K)), (Ypos-y), (2*(uint16_t)(x/K) + 1));
-    
-    e2 = err;
-    if (e2 <= x) 
+  EllipseWalkTypeDef walk;
+  int dx, dy;
+  uint8_t clip;
+
+  dx = EllipseHalfWidth(XRadius, YRadius);
+  clip = ClipBox(Xpos - dx, Ypos - YRadius, Xpos + dx, Ypos + YRadius);
+  if (clip == CLIP_OUTSIDE)
+  {
+    return;
+  }
+
+  SpanBegin(DrawProp[ActiveLayer].TextColor);
+  EllipseBegin(&walk, XRadius, YRadius);
+  while (EllipseNext(&walk, &dx, &dy))
+  {
+    SpanFill(Xpos - dx, Ypos + dy, 2*dx + 1, clip);
+    SpanFill(Xpos - dx, Ypos - dy, 2*dx + 1, clip);
+  }
+  SpanEnd();
+}
+
+/**
+  * @brief  Displays an anti-aliased line (between two points).
+  * @param  X1: the point 1 X position
+  * @param  Y1: the point 1 Y position
+  * @param  X2: the point 2 X position
+  * @param  Y2: the point 2 Y position
+  * @note   Two pixels per step across the line share its coverage, taken
+  *         from the fractional part of a 16.16 fixed-point position.
+  */
+void BSP_LCD_DrawLineAA(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+{
+  int32_t x1 = X1, y1 = Y1, x2 = X2, y2 = Y2, swap = 0, major = 0, minor = 0, gradient = 0, step = 0;
+  uint32_t color = DrawProp[ActiveLayer].TextColor, alpha = 0;
+  uint8_t steep, clip;
+
+  clip = ClipBox(MIN(x1, x2), MIN(y1, y2), MAX(x1, x2) + 1, MAX(y1, y2) + 1);
+  if(clip == CLIP_OUTSIDE)
+  {
+    return;
+  }
+
+  /* Step along the longer axis, from the lower end */
+  steep = ABS(y2 - y1) > ABS(x2 - x1);
+  if(steep)
+  {
+    swap = x1; x1 = y1; y1 = swap;
+    swap = x2; x2 = y2; y2 = swap;
+  }
+  if(x1 > x2)
+  {
+    swap = x1; x1 = x2; x2 = swap;
+    swap = y1; y1 = y2; y2 = swap;
+  }
+
+  gradient = (x2 == x1) ? 0 : (int32_t)(((int64_t)(y2 - y1) << 16) / (x2 - x1));
+  minor = y1 << 16;
+  for(major = x1; major <= x2; major++)
+  {
+    step = minor >> 16;
+    alpha = (minor >> 8) & 0xFF;
+    if(steep)
+    {
+      BlendPixel(step, major, color, 255 - alpha, clip);
+      BlendPixel(step + 1, major, color, alpha, clip);
+    }
+    else
+    {
+      BlendPixel(major, step, color, 255 - alpha, clip);
+      BlendPixel(major, step + 1, color, alpha, clip);
+    }
+    minor += gradient;
+  }
+}
+
+/**
+  * @brief  Displays a full circle with an anti-aliased edge.
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position
+  * @param  Radius: the circle radius
+  * @note   The inside goes out as DMA2D spans. Edge pixels get the coverage
+  *         (Radius + 1/2) - d, linearised as ((2R+1)^2 - 4d^2) / (4(2R+1))
+  *         so that it needs no square root per pixel.
+  */
+void BSP_LCD_FillCircleAA(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+  int32_t dx = 0, dy = 0, inner = 0, outer = 0, square = 0, band = 0, room = 0;
+  uint32_t color = DrawProp[ActiveLayer].TextColor, alpha = 0;
+  uint8_t clip;
+
+  clip = ClipBox(Xpos - Radius, Ypos - Radius, Xpos + Radius, Ypos + Radius);
+  if(clip == CLIP_OUTSIDE)
+  {
+    return;
+  }
+
+  square = (2 * Radius + 1) * (2 * Radius + 1);
+  band = 4 * (2 * Radius + 1);
+
+  SpanBegin(color);
+  for(dy = -Radius; dy <= (int32_t)Radius; dy++)
+  {
+    /* Partly covered from inner + 1 to outer, fully up to inner */
+    room = square - 4 * dy * dy;
+    outer = ISqrt((room - 1) / 4);
+    inner = (room >= band) ? (int32_t)ISqrt((room - band) / 4) : -1;
+
+    if(inner >= 0)
     {
-      err += ++x*2+1;
-      if (-y == x && e2 <= y) e2 = 0;
+      SpanFill(Xpos - inner, Ypos + dy, 2 * inner + 1, clip);
+    }
+    for(dx = inner + 1; dx <= outer; dx++)
+    {
+      alpha = (255 * (uint32_t)(room - 4 * dx * dx)) / band;
+      BlendPixel(Xpos - dx, Ypos + dy, color, alpha, clip);
+      BlendPixel(Xpos + dx, Ypos + dy, color, alpha, clip);
     }
-    if (e2 > y) err += ++y*2+1;
   }
-  while (y <= 0);
+  SpanEnd();
 }
 
 /**
@@ -1365,6 +1705,368 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
   }
 }
 
+/**
+  * @brief  Copies a character pre-expanded to ARGB8888 to the LCD.
+  * @param  Xpos: start column address
+  * @param  Ypos: the Line where to display the character shape
+  * @param  c: pointer to the character pixels
+  */
+static void CopyChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
+{
+  uint16_t width = DrawProp[ActiveLayer].pFont->Width;
+  uint16_t height = DrawProp[ActiveLayer].pFont->Height;
+  uint32_t address = LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + 4*(Ypos*BSP_LCD_GetXSize() + Xpos);
+
+  /* Memory to memory, no conversion: the glyph is already in frame buffer format */
+  Dma2dHandler.Init.Mode         = DMA2D_M2M;
+  Dma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
+  Dma2dHandler.Init.OutputOffset = BSP_LCD_GetXSize() - width;
+
+  /* Foreground Configuration */
+  Dma2dHandler.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  Dma2dHandler.LayerCfg[1].InputAlpha = 0xFF;
+  Dma2dHandler.LayerCfg[1].InputColorMode = CM_ARGB8888;
+  Dma2dHandler.LayerCfg[1].InputOffset = 0;
+
+  Dma2dHandler.Instance = DMA2D;
+
+  /* DMA2D Initialization */
+  if(HAL_DMA2D_Init(&Dma2dHandler) == HAL_OK)
+  {
+    if(HAL_DMA2D_ConfigLayer(&Dma2dHandler, 1) == HAL_OK)
+    {
+      if (HAL_DMA2D_Start(&Dma2dHandler, (uint32_t)c, address, width, height) == HAL_OK)
+      {
+        /* Polling For DMA transfer */
+        HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Draws a character from a coverage mask: the cell is filled with
+  *         the back colour, then DMA2D blends the text colour over it.
+  * @param  Xpos: start column address
+  * @param  Ypos: the Line where to display the character shape
+  * @param  c: pointer to the character mask
+  * @param  ColorMode: CM_A8 or CM_A4
+  */
+static void BlendChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c, uint32_t ColorMode)
+{
+  uint16_t width = DrawProp[ActiveLayer].pFont->Width;
+  uint16_t height = DrawProp[ActiveLayer].pFont->Height;
+  uint32_t address = LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + 4*(Ypos*BSP_LCD_GetXSize() + Xpos);
+
+  FillBuffer(ActiveLayer, (uint32_t *)address, width, height, BSP_LCD_GetXSize() - width, DrawProp[ActiveLayer].BackColor);
+
+  /* Memory to memory with blending, back into the cell */
+  Dma2dHandler.Init.Mode         = DMA2D_M2M_BLEND;
+  Dma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
+  Dma2dHandler.Init.OutputOffset = BSP_LCD_GetXSize() - width;
+
+  /* Foreground: the mask, in the text colour */
+  Dma2dHandler.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  Dma2dHandler.LayerCfg[1].InputAlpha = DrawProp[ActiveLayer].TextColor;
+  Dma2dHandler.LayerCfg[1].InputColorMode = ColorMode;
+  Dma2dHandler.LayerCfg[1].InputOffset = 0;
+
+  /* Background: the cell itself */
+  Dma2dHandler.LayerCfg[0].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  Dma2dHandler.LayerCfg[0].InputAlpha = 0xFF;
+  Dma2dHandler.LayerCfg[0].InputColorMode = CM_ARGB8888;
+  Dma2dHandler.LayerCfg[0].InputOffset = BSP_LCD_GetXSize() - width;
+
+  Dma2dHandler.Instance = DMA2D;
+
+  /* DMA2D Initialization */
+  if(HAL_DMA2D_Init(&Dma2dHandler) == HAL_OK)
+  {
+    if((HAL_DMA2D_ConfigLayer(&Dma2dHandler, 0) == HAL_OK) && (HAL_DMA2D_ConfigLayer(&Dma2dHandler, 1) == HAL_OK))
+    {
+      if (HAL_DMA2D_BlendingStart(&Dma2dHandler, (uint32_t)c, address, address, width, height) == HAL_OK)
+      {
+        /* Polling For DMA transfer */
+        HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Latches the active layer's frame buffer and size, and tells how
+  *         much of a bounding box is on screen.
+  * @param  X1: left column
+  * @param  Y1: top row
+  * @param  X2: right column (inclusive)
+  * @param  Y2: bottom row (inclusive)
+  * @retval CLIP_OUTSIDE, CLIP_PARTIAL or CLIP_INSIDE
+  */
+static uint8_t ClipBox(int32_t X1, int32_t Y1, int32_t X2, int32_t Y2)
+{
+  CanvasBuffer = (uint32_t *)LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress;
+  CanvasWidth = BSP_LCD_GetXSize();
+  CanvasHeight = BSP_LCD_GetYSize();
+
+  if ((X2 < 0) || (Y2 < 0) || (X1 >= CanvasWidth) || (Y1 >= CanvasHeight))
+  {
+    return CLIP_OUTSIDE;
+  }
+  if ((X1 >= 0) && (Y1 >= 0) && (X2 < CanvasWidth) && (Y2 < CanvasHeight))
+  {
+    return CLIP_INSIDE;
+  }
+  return CLIP_PARTIAL;
+}
+
+/**
+  * @brief  Fills a rectangle, clipped to the screen, with one DMA2D transfer.
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  */
+static void FillRegion(int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height)
+{
+  int32_t x2 = Xpos + Width, y2 = Ypos + Height;
+
+  if ((Width <= 0) || (Height <= 0) || (ClipBox(Xpos, Ypos, x2 - 1, y2 - 1) == CLIP_OUTSIDE))
+  {
+    return;
+  }
+  Xpos = MAX(Xpos, 0);
+  Ypos = MAX(Ypos, 0);
+  x2 = MIN(x2, CanvasWidth);
+  y2 = MIN(y2, CanvasHeight);
+
+  FillBuffer(ActiveLayer, CanvasBuffer + Ypos * CanvasWidth + Xpos, x2 - Xpos, y2 - Ypos,
+             CanvasWidth - (x2 - Xpos), DrawProp[ActiveLayer].TextColor);
+}
+
+/**
+  * @brief  Writes a pixel of the canvas latched by ClipBox.
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position
+  * @param  Color: the pixel color in ARGB mode (8-8-8-8)
+  * @param  Clip: CLIP_INSIDE when the pixel is known to be on screen
+  */
+static void PlotPixel(int32_t Xpos, int32_t Ypos, uint32_t Color, uint8_t Clip)
+{
+  if ((Clip != CLIP_INSIDE) &&
+      ((Xpos < 0) || (Ypos < 0) || (Xpos >= CanvasWidth) || (Ypos >= CanvasHeight)))
+  {
+    return;
+  }
+  CanvasBuffer[Ypos * CanvasWidth + Xpos] = Color;
+}
+
+/**
+  * @brief  Writes a column of pixels of the span color with the CPU.
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position of the top pixel
+  * @param  Length: column length
+  * @param  Clip: CLIP_INSIDE when the column is known to be on screen
+  */
+static void FillColumn(int32_t Xpos, int32_t Ypos, int32_t Length, uint8_t Clip)
+{
+  uint32_t *pixel;
+
+  if (Clip != CLIP_INSIDE)
+  {
+    if ((Xpos < 0) || (Xpos >= CanvasWidth))
+    {
+      return;
+    }
+    if (Ypos < 0)
+    {
+      Length += Ypos;
+      Ypos = 0;
+    }
+    Length = MIN(Length, CanvasHeight - Ypos);
+  }
+
+  for (pixel = CanvasBuffer + Ypos * CanvasWidth + Xpos; Length > 0; Length--)
+  {
+    *pixel = SpanColor;
+    pixel += CanvasWidth;
+  }
+}
+
+/**
+  * @brief  Sets DMA2D up once for a run of spans on the canvas latched by
+  *         ClipBox, each of which then only needs its address and length.
+  * @param  Color: the span color in ARGB mode (8-8-8-8)
+  */
+static void SpanBegin(uint32_t Color)
+{
+  SpanColor = Color;
+  SpanPending = 0;
+
+  /* Register to memory mode, one line per transfer */
+  Dma2dHandler.Init.Mode         = DMA2D_R2M;
+  Dma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
+  Dma2dHandler.Init.OutputOffset = 0;
+
+  Dma2dHandler.Instance = DMA2D;
+
+  SpanDma = (HAL_DMA2D_Init(&Dma2dHandler) == HAL_OK) &&
+            (HAL_DMA2D_ConfigLayer(&Dma2dHandler, ActiveLayer) == HAL_OK);
+}
+
+/**
+  * @brief  Fills a horizontal span. Long spans go to DMA2D, which works on
+  *         one while the CPU computes the next.
+  * @param  Xpos: the X position of the first pixel
+  * @param  Ypos: the Y position
+  * @param  Length: span length
+  * @param  Clip: CLIP_INSIDE when the span is known to be on screen
+  */
+static void SpanFill(int32_t Xpos, int32_t Ypos, int32_t Length, uint8_t Clip)
+{
+  uint32_t *pixel, *end;
+
+  if (Clip != CLIP_INSIDE)
+  {
+    if ((Ypos < 0) || (Ypos >= CanvasHeight))
+    {
+      return;
+    }
+    if (Xpos < 0)
+    {
+      Length += Xpos;
+      Xpos = 0;
+    }
+    Length = MIN(Length, CanvasWidth - Xpos);
+  }
+  if (Length <= 0)
+  {
+    return;
+  }
+
+  pixel = CanvasBuffer + Ypos * CanvasWidth + Xpos;
+  if (SpanDma && (Length >= SPAN_DMA_MIN_LENGTH))
+  {
+    if (SpanPending)
+    {
+      HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
+    }
+    SpanPending = (HAL_DMA2D_Start(&Dma2dHandler, SpanColor, (uint32_t)pixel, Length, 1) == HAL_OK);
+    return;
+  }
+
+  for (end = pixel + Length; pixel < end; pixel++)
+  {
+    *pixel = SpanColor;
+  }
+}
+
+/**
+  * @brief  Waits for the last span of a run.
+  */
+static void SpanEnd(void)
+{
+  if (SpanPending)
+  {
+    HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
+    SpanPending = 0;
+  }
+}
+
+/**
+  * @brief  Sets a polygon edge's x to Numerator / Denominator, split into
+  *         its integer part (rounded down) and fraction.
+  * @param  Edge: the edge, with its Denominator set
+  * @param  Numerator: x in 1 / Denominator
+  */
+static void PolyEdgeSet(PolyEdgeTypeDef *Edge, int64_t Numerator)
+{
+  int64_t x = Numerator / Edge->Denominator;
+
+  if((x * Edge->Denominator) > Numerator)
+  {
+    x--;
+  }
+  Edge->X = (int32_t)x;
+  Edge->Error = (int32_t)(Numerator - x * Edge->Denominator);
+}
+
+/**
+  * @brief  Tells whether a polygon edge is left of another on this scanline.
+  * @param  A: first edge
+  * @param  B: second edge
+  * @retval 1 if A is left of B
+  */
+static uint8_t PolyEdgeBefore(const PolyEdgeTypeDef *A, const PolyEdgeTypeDef *B)
+{
+  if(A->X != B->X)
+  {
+    return A->X < B->X;
+  }
+  return ((int64_t)A->Error * B->Denominator) < ((int64_t)B->Error * A->Denominator);
+}
+
+/**
+  * @brief  Blends a colour into a pixel of the canvas latched by ClipBox.
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position
+  * @param  Color: the color in ARGB mode (8-8-8-8)
+  * @param  Alpha: coverage, 0 (none) to 255 (full)
+  * @param  Clip: CLIP_INSIDE when the pixel is known to be on screen
+  */
+static void BlendPixel(int32_t Xpos, int32_t Ypos, uint32_t Color, uint32_t Alpha, uint8_t Clip)
+{
+  uint32_t *pixel, back, blend = 0, shift;
+
+  if((Alpha == 0) ||
+     ((Clip != CLIP_INSIDE) &&
+      ((Xpos < 0) || (Ypos < 0) || (Xpos >= CanvasWidth) || (Ypos >= CanvasHeight))))
+  {
+    return;
+  }
+  pixel = CanvasBuffer + Ypos * CanvasWidth + Xpos;
+  if(Alpha >= 255)
+  {
+    *pixel = Color;
+    return;
+  }
+
+  back = *pixel;
+  for(shift = 0; shift < 32; shift += 8)
+  {
+    blend |= ((((Color >> shift) & 0xFF) * Alpha + ((back >> shift) & 0xFF) * (255 - Alpha)) / 255) << shift;
+  }
+  *pixel = blend;
+}
+
+/**
+  * @brief  Integer square root, rounded down.
+  * @param  Value: the radicand
+  * @retval floor(sqrt(Value))
+  */
+static uint32_t ISqrt(uint32_t Value)
+{
+  uint32_t root = 0, bit = 1UL << 30;
+
+  while(bit > Value)
+  {
+    bit >>= 2;
+  }
+  while(bit != 0)
+  {
+    if(Value >= root + bit)
+    {
+      Value -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
 /**
   * @brief  Fills buffer.
   * @param  LayerIndex: layer index
@@ -47,6 +47,8 @@
 /* Include SDRAM Driver */
 #include "stm32f429i_discovery_sdram.h"
 #include "fonts.h"
+#include "font_subset.h"
+#include "bitmaps.h"
 /* Include LCD component driver */
 #include "ili9341.h"   
 
@@ -142,7 +144,7 @@ typedef enum
 /** 
   * @brief LCD default font 
   */ 
-#define LCD_DEFAULT_FONT         Font24
+#define LCD_DEFAULT_FONT         Font16Subset
 
 /** 
   * @brief  LCD Reload Types
@@ -225,6 +227,7 @@ void     BSP_LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 void     BSP_LCD_DrawPolygon(pPoint Points, uint16_t PointCount);
 void     BSP_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
 void     BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp);
+void     BSP_LCD_DrawPackedBitmap(uint32_t X, uint32_t Y, const sBITMAP *pBitmap);
 
 void     BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 void     BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
@@ -232,6 +235,9 @@ void     BSP_LCD_FillTriangle(uint16_t X1, uint16_t X2, uint16_t X3, uint16_t Y1
 void     BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount);
 void     BSP_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
 
+void     BSP_LCD_DrawLineAA(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
+void     BSP_LCD_FillCircleAA(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
+
 void     BSP_LCD_DisplayOff(void);
 void     BSP_LCD_DisplayOn(void);
 
@@ -77,6 +77,7 @@
   */
 static TS_DrvTypeDef     *TsDrv;
 static uint16_t          TsXBoundary, TsYBoundary; 
+static uint8_t           TsFifoData[4 * TS_BURST_POINTS];
 /**
   * @}
   */
@@ -138,6 +139,33 @@ uint8_t BSP_TS_ITConfig(void)
   return TS_OK;
 }
 
+/**
+  * @brief  Enables the touch screen interrupts for batched reading: the
+  *         interrupt fires once the FIFO holds Threshold points, on touch and
+  *         lift, and on FIFO overflow, rather than for each point.
+  * @note   Unlike BSP_TS_ITConfig, this leaves the MCU's interrupt line
+  *         (STMPE811_INT_PIN) to the caller, e.g. an mbed InterruptIn.
+  * @param  Threshold: FIFO points per interrupt, 1 to 127
+  * @retval TS_OK: if ITconfig is OK. Other value if error.
+  */
+uint8_t BSP_TS_ITConfigThreshold(uint8_t Threshold)
+{
+  if((Threshold == 0) || (Threshold > 127))
+  {
+    return TS_ERROR;
+  }
+
+  stmpe811_TS_SetFifoThreshold(TS_I2C_ADDRESS, Threshold);
+
+  /* Only the sources that need attention; FIFO empty would fire on each read */
+  stmpe811_DisableITSource(TS_I2C_ADDRESS, STMPE811_TS_IT);
+  stmpe811_ClearGlobalIT(TS_I2C_ADDRESS, STMPE811_TS_IT);
+  stmpe811_EnableITSource(TS_I2C_ADDRESS, STMPE811_GIT_TOUCH | STMPE811_GIT_FTH | STMPE811_GIT_FOV);
+  stmpe811_EnableGlobalIT(TS_I2C_ADDRESS);
+
+  return TS_OK;
+}
+
 /**
   * @brief  Gets the TS IT status.
   * @retval Interrupt status.
@@ -225,6 +253,38 @@ void BSP_TS_GetState(TS_StateTypeDef* TsState)
   }
 }
 
+/**
+  * @brief  Drains the touch FIFO in one I2C burst, without the corrections
+  *         and deadband of BSP_TS_GetState: the points are raw ADC values.
+  * @param  Points: room for Size points
+  * @param  Size: number of points Points can hold, at most TS_BURST_POINTS
+  * @param  TouchDetected: set to 1 while the screen is touched
+  * @retval Number of points read
+  */
+uint8_t BSP_TS_ReadPoints(TS_PointTypeDef *Points, uint8_t Size, uint8_t *TouchDetected)
+{
+  uint8_t count, index;
+  uint8_t *data = TsFifoData;
+
+  *TouchDetected = ((IOE_Read(TS_I2C_ADDRESS, STMPE811_REG_TSC_CTRL) & STMPE811_TS_CTRL_STATUS) != 0);
+
+  if(Size > TS_BURST_POINTS)
+  {
+    Size = TS_BURST_POINTS;
+  }
+  count = stmpe811_TS_ReadFifo(TS_I2C_ADDRESS, TsFifoData, Size);
+
+  for(index = 0; index < count; index++)
+  {
+    Points[index].X = (data[0] << 4) | (data[1] >> 4);
+    Points[index].Y = ((data[1] & 0x0F) << 8) | data[2];
+    Points[index].Z = data[3];
+    data += 4;
+  }
+
+  return count;
+}
+
 /**
   * @brief  Clears all touch screen interrupts.
   */  
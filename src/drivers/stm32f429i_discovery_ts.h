@@ -69,6 +69,13 @@ typedef struct
   uint16_t Y;
   uint16_t Z;
 }TS_StateTypeDef;
+
+typedef struct
+{
+  uint16_t X;   /* Raw 12 bit ADC value */
+  uint16_t Y;   /* Raw 12 bit ADC value */
+  uint8_t  Z;   /* Pressure */
+}TS_PointTypeDef;
 /**
   * @}
   */
@@ -81,6 +88,11 @@ typedef struct
 #define TS_SWAP_Y                       0x02
 #define TS_SWAP_XY                      0x04
 
+/* Most points BSP_TS_ReadPoints reads in one I2C burst */
+#ifndef TS_BURST_POINTS
+ #define TS_BURST_POINTS                16
+#endif
+
 typedef enum 
 {
   TS_OK       = 0x00,
@@ -104,6 +116,8 @@ typedef enum
 uint8_t BSP_TS_Init(uint16_t XSize, uint16_t YSize);
 void    BSP_TS_GetState(TS_StateTypeDef *TsState);
 uint8_t BSP_TS_ITConfig(void);
+uint8_t BSP_TS_ITConfigThreshold(uint8_t Threshold);
+uint8_t BSP_TS_ReadPoints(TS_PointTypeDef *Points, uint8_t Size, uint8_t *TouchDetected);
 uint8_t BSP_TS_ITGetStatus(void);
 void    BSP_TS_ITClear(void);
 
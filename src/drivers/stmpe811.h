@@ -253,6 +253,8 @@ void     stmpe811_TS_EnableIT(uint16_t DeviceAddr);
 void     stmpe811_TS_DisableIT(uint16_t DeviceAddr);
 uint8_t  stmpe811_TS_ITStatus (uint16_t DeviceAddr);
 void     stmpe811_TS_ClearIT (uint16_t DeviceAddr);
+void     stmpe811_TS_SetFifoThreshold(uint16_t DeviceAddr, uint8_t Threshold);
+uint8_t  stmpe811_TS_ReadFifo(uint16_t DeviceAddr, uint8_t *pData, uint8_t Size);
 
 void     IOE_Init(void);
 void     IOE_ITConfig (void);
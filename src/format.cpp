@@ -0,0 +1,66 @@
+#include "format.h"
+
+static const uint32_t powers[] = {1000000000, 100000000, 10000000, 1000000,
+                                  100000,     10000,     1000,     100,
+                                  10,         1};
+static const float scales[] = {1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f};
+
+#define DIGITS 10
+
+// Digits of value, with at least decimals + 1 of them and a decimal point
+// before the last decimals
+static char *formatScaled(char *out, uint32_t value, int decimals) {
+  bool started = false;
+  for (int i = 0; i < DIGITS; ++i) {
+    int position = DIGITS - 1 - i;  // from the right
+    char digit = '0';
+    while (value >= powers[i]) {
+      value -= powers[i];
+      digit++;
+    }
+    if (!started && digit == '0' && position > decimals) {
+      continue;
+    }
+    started = true;
+    if (position == decimals - 1) {
+      *out++ = '.';
+    }
+    *out++ = digit;
+  }
+  return out;
+}
+
+char *formatFixed(char *out, float value, int decimals) {
+  if (decimals < 0) {
+    decimals = 0;
+  } else if (decimals > 4) {
+    decimals = 4;
+  }
+  bool negative = value < 0.0f;
+  float scaled = (negative ? -value : value) * scales[decimals] + 0.5f;
+  // Also catches NaN, for which the comparison is false
+  if (!(scaled < 4294967040.0f)) {
+    return formatText(out, out + 3, "---");
+  }
+  uint32_t units = (uint32_t)scaled;
+  if (negative && units > 0) {
+    *out++ = '-';
+  }
+  return formatScaled(out, units, decimals);
+}
+
+char *formatInt(char *out, int32_t value) {
+  uint32_t magnitude = (uint32_t)value;
+  if (value < 0) {
+    *out++ = '-';
+    magnitude = 0u - magnitude;
+  }
+  return formatScaled(out, magnitude, 0);
+}
+
+char *formatText(char *out, const char *end, const char *text) {
+  while (*text != '\0' && out < end) {
+    *out++ = *text++;
+  }
+  return out;
+}
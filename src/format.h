@@ -0,0 +1,23 @@
+#ifndef __FORMAT_H
+#define __FORMAT_H
+
+#include <stdint.h>
+
+// Number to text without printf: the value is scaled to an integer and its
+// digits are taken off a table of powers of ten, so there is no division
+// and no locale. Each function writes at out, appends no terminator and
+// returns the end of what it wrote; out needs room for FORMAT_MAX_CHARS
+
+// Longest output: sign, ten digits and a decimal point
+#define FORMAT_MAX_CHARS 12
+
+// value with a fixed number of decimals (0 to 4), rounded half away from
+// zero. Values too large for the scaled integer come out as "---"
+char *formatFixed(char *out, float value, int decimals);
+
+char *formatInt(char *out, int32_t value);
+
+// Copy text without its terminator, writing no further than end
+char *formatText(char *out, const char *end, const char *text);
+
+#endif
@@ -0,0 +1,44 @@
+#include "gaitbands.h"
+
+#include "config.h"
+#include "decimator.h"
+#include "goertzel.h"
+
+// Stride frequencies from a slow walk to a run
+static GoertzelBank<GAIT_BANDS_RATE, 500, 750, 1000, 1250, 1500, 2000, 2500,
+                    3000>
+    bank;
+static Decimator<GAIT_BANDS_RATE> decimator;
+
+bool updateGaitBands(float rate, uint64_t timestampUs) {
+  float sample;
+  if (!decimator.update(rate, timestampUs, &sample)) {
+    return false;
+  }
+  bank.update(sample);
+  return true;
+}
+
+int gaitBandCount() { return bank.kBins; }
+
+float gaitBandFrequency(int i) { return bank.frequency(i); }
+
+float gaitBandPower(int i) { return bank.power(i); }
+
+float gaitBandTotal() {
+  float total = 0.0f;
+  for (int i = 0; i < bank.kBins; ++i) {
+    total += bank.power(i);
+  }
+  return total;
+}
+
+float gaitBandPeak() {
+  int peak = 0;
+  for (int i = 1; i < bank.kBins; ++i) {
+    if (bank.power(i) > bank.power(peak)) {
+      peak = i;
+    }
+  }
+  return bank.frequency(peak);
+}
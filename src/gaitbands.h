@@ -0,0 +1,20 @@
+#ifndef __GAITBANDS_H
+#define __GAITBANDS_H
+
+#include <stdint.h>
+
+// Feed one angular rate sample (rad/s) about the swing axis. It is averaged
+// down to GAIT_BANDS_RATE and run through the Goertzel bank. Returns true
+// when the band powers were updated
+bool updateGaitBands(float rate, uint64_t timestampUs);
+
+// Number of bins, the centre (Hz) and power ((rad/s)^2) of bin i
+int gaitBandCount();
+float gaitBandFrequency(int i);
+float gaitBandPower(int i);
+
+// Total power over the bank, and the centre (Hz) of the strongest bin
+float gaitBandTotal();
+float gaitBandPeak();
+
+#endif
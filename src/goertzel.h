@@ -0,0 +1,79 @@
+#ifndef __GOERTZEL_H
+#define __GOERTZEL_H
+
+// Bank of leaky (exponentially windowed) Goertzel resonators. The bin
+// layout is fixed at compile time: RateHz is the input sample rate and each
+// of BinsMilliHz a bin centre in mHz. Every sample costs two multiplies and
+// two adds per bin, and the power of any bin can be read at any time.
+//
+//   GoertzelBank<32, 1000, 2000> bank;  // 1 Hz and 2 Hz bins at 32 Hz
+//   bank.update(x);
+//   float p = bank.power(1);  // ~ A^2 for a 2 Hz sine of amplitude A
+
+namespace goertzel {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Taylor series cosine, usable in constant expressions
+constexpr double cosine(double x) {
+  while (x > kPi) x -= 2.0 * kPi;
+  while (x < -kPi) x += 2.0 * kPi;
+  double term = 1.0, sum = 1.0;
+  for (int n = 1; n < 20; ++n) {
+    term *= -x * x / ((2 * n - 1) * (2 * n));
+    sum += term;
+  }
+  return sum;
+}
+
+}  // namespace goertzel
+
+template <int RateHz, int... BinsMilliHz>
+class GoertzelBank {
+ public:
+  static constexpr int kBins = sizeof...(BinsMilliHz);
+  // Pole radius: a time constant of about 1.5 s whatever the rate
+  static constexpr float kDecay = 1.0f - 2.0f / (3.0f * RateHz);
+
+  void update(float x) {
+    for (int i = 0; i < kBins; ++i) {
+      float s = x + kCoeff[i] * s1_[i] - kDecay * kDecay * s2_[i];
+      s2_[i] = s1_[i];
+      s1_[i] = s;
+    }
+  }
+
+  // Power at bin i, scaled so a sine of amplitude A reads about A^2
+  float power(int i) const {
+    float p = s1_[i] * s1_[i] + kDecay * kDecay * s2_[i] * s2_[i] -
+              kCoeff[i] * s1_[i] * s2_[i];
+    return p * kScale;
+  }
+
+  static constexpr float frequency(int i) { return kBinsHz[i]; }
+
+ private:
+  static constexpr float kBinsHz[kBins] = {(BinsMilliHz / 1000.0f)...};
+  // 2 r cos(w) for each bin, computed by the compiler
+  static constexpr float kCoeff[kBins] = {
+      (float)(2.0 * kDecay *
+              goertzel::cosine(2.0 * goertzel::kPi * BinsMilliHz / 1000.0 /
+                               RateHz))...};
+  // Resonator gain at its centre is 1 / (2 (1 - r)) for each sine component
+  static constexpr float kScale = 4.0f * (1.0f - kDecay) * (1.0f - kDecay);
+
+  float s1_[kBins] = {};
+  float s2_[kBins] = {};
+};
+
+// Indexed at run time, so gnu++14 needs the tables defined out of class
+template <int RateHz, int... BinsMilliHz>
+constexpr float GoertzelBank<RateHz, BinsMilliHz...>::kBinsHz[];
+template <int RateHz, int... BinsMilliHz>
+constexpr float GoertzelBank<RateHz, BinsMilliHz...>::kCoeff[];
+template <int RateHz, int... BinsMilliHz>
+constexpr float GoertzelBank<RateHz, BinsMilliHz...>::kDecay;
+template <int RateHz, int... BinsMilliHz>
+constexpr float GoertzelBank<RateHz, BinsMilliHz...>::kScale;
+
+#endif
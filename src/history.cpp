@@ -0,0 +1,134 @@
+#include "history.h"
+
+#include <cmath>
+
+float HistoryStats::mean() const { return count ? sum / count : 0.0f; }
+
+float HistoryStats::variance() const {
+  if (count == 0) {
+    return 0.0f;
+  }
+  float m = sum / count;
+  float v = sumSquared / count - m * m;
+  return v > 0.0f ? v : 0.0f;
+}
+
+uint32_t HistoryPyramid::blockSize(int level) {
+  uint32_t size = 1;
+  while (level-- > 0) {
+    size *= HISTORY_FANOUT;
+  }
+  return size;
+}
+
+void HistoryPyramid::add(float value) {
+  Block b = {value, value, value, value * value};
+  total_++;
+  for (int level = 0;; ++level) {
+    uint32_t count = blockCount(level);
+    blocks_[level][(count - 1) % HISTORY_CAPACITY] = b;
+    if (level + 1 == HISTORY_LEVELS) {
+      break;
+    }
+    // Fold the block just completed into its parent
+    Block &parent = pending_[level + 1];
+    if ((count - 1) % HISTORY_FANOUT == 0) {
+      parent = b;
+    } else {
+      parent.min = fminf(parent.min, b.min);
+      parent.max = fmaxf(parent.max, b.max);
+      parent.sum += b.sum;
+      parent.sumSquared += b.sumSquared;
+    }
+    if (count % HISTORY_FANOUT != 0) {
+      break;
+    }
+    b = parent;
+  }
+}
+
+bool HistoryPyramid::held(int level, uint32_t index) const {
+  uint32_t count = blockCount(level);
+  return index < count && index + HISTORY_CAPACITY >= count;
+}
+
+bool HistoryPyramid::agedOut(int level, uint32_t index) const {
+  return index + HISTORY_CAPACITY < blockCount(level);
+}
+
+void HistoryPyramid::take(int level, uint32_t index,
+                          HistoryStats *stats) const {
+  const Block &b = blocks_[level][index % HISTORY_CAPACITY];
+  stats->min = fminf(stats->min, b.min);
+  stats->max = fmaxf(stats->max, b.max);
+  stats->sum += b.sum;
+  stats->sumSquared += b.sumSquared;
+  stats->count += blockSize(level);
+}
+
+HistoryStats HistoryPyramid::range(uint32_t begin, uint32_t end) const {
+  HistoryStats stats = {INFINITY, -INFINITY, 0.0f, 0.0f, 0};
+  if (end > total_) {
+    end = total_;
+  }
+  if (begin >= end) {
+    return stats;
+  }
+
+  // Start at the finest level still holding the first sample
+  int level = 0;
+  while (level + 1 < HISTORY_LEVELS && !held(level, begin / blockSize(level))) {
+    level++;
+  }
+  uint32_t size = blockSize(level);
+  if (!held(level, begin / size)) {
+    // Older than the coarsest level: clamp to what is left
+    uint32_t count = blockCount(level);
+    begin = (count - HISTORY_CAPACITY) * size;
+  }
+  begin -= begin % size;
+
+  // Up: finish the partial block at each level, then move to its parent
+  for (; level + 1 < HISTORY_LEVELS; ++level) {
+    size = blockSize(level);
+    uint32_t parentSize = size * HISTORY_FANOUT;
+    while (begin % parentSize != 0 && begin + size <= end) {
+      take(level, begin / size, &stats);
+      begin += size;
+    }
+    if (begin + parentSize > end) {
+      break;
+    }
+  }
+  // Down: whole blocks at each level, the remainder at the finer ones
+  for (; level >= 0; --level) {
+    size = blockSize(level);
+    while (begin + size <= end) {
+      take(level, begin / size, &stats);
+      begin += size;
+    }
+    // An old remainder has aged out of the finer levels: round the end up.
+    // A recent one is only missing because the finer block is not complete
+    // yet, and the levels below still hold it
+    if (begin < end && level > 0 &&
+        agedOut(level - 1, begin / blockSize(level - 1))) {
+      take(level, begin / size, &stats);
+      break;
+    }
+  }
+  return stats;
+}
+
+HistoryStats HistoryPyramid::latest(uint32_t count) const {
+  return range(count < total_ ? total_ - count : 0, total_);
+}
+
+bool HistoryPyramid::block(int level, int ago, HistoryStats *out) const {
+  uint32_t count = blockCount(level);
+  if (ago < 0 || (uint32_t)ago >= count || ago >= HISTORY_CAPACITY) {
+    return false;
+  }
+  const Block &b = blocks_[level][(count - 1 - ago) % HISTORY_CAPACITY];
+  *out = {b.min, b.max, b.sum, b.sumSquared, blockSize(level)};
+  return true;
+}
@@ -0,0 +1,57 @@
+#ifndef __HISTORY_H
+#define __HISTORY_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+// Min, max, sum and sum of squares over a run of samples
+struct HistoryStats {
+  float min;
+  float max;
+  float sum;
+  float sumSquared;
+  uint32_t count;
+
+  float mean() const;
+  float variance() const;
+};
+
+// Long history of one signal kept at HISTORY_LEVELS resolutions: level l
+// holds the last HISTORY_CAPACITY blocks of HISTORY_FANOUT^l samples. Adding
+// a sample is O(1) amortised, and stats over any range cost O(log N) blocks
+// instead of a scan. Old ranges are only kept at the coarser levels, so they
+// are rounded out to the finest blocks still held for that age
+class HistoryPyramid {
+ public:
+  void add(float value);
+
+  // Samples added so far; sample indices below count from 0 at the first
+  uint32_t samples() const { return total_; }
+
+  // Stats over samples [begin, end), or over the latest count samples
+  HistoryStats range(uint32_t begin, uint32_t end) const;
+  HistoryStats latest(uint32_t count) const;
+
+  // Complete block at a level, ago = 0 being the latest: one plot column at
+  // that zoom. Returns false once it has aged out or does not exist yet
+  bool block(int level, int ago, HistoryStats *out) const;
+
+ private:
+  struct Block {
+    float min, max, sum, sumSquared;
+  };
+
+  static uint32_t blockSize(int level);
+  uint32_t blockCount(int level) const { return total_ / blockSize(level); }
+  bool held(int level, uint32_t index) const;
+  bool agedOut(int level, uint32_t index) const;
+  void take(int level, uint32_t index, HistoryStats *stats) const;
+
+  Block blocks_[HISTORY_LEVELS][HISTORY_CAPACITY];
+  // Block being built at each level above the first
+  Block pending_[HISTORY_LEVELS];
+  uint32_t total_ = 0;
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef __KAHAN_H
+#define __KAHAN_H
+
+// Compensated (Kahan) float sum: keeps small per-sample increments from
+// being lost once the total is large. Do not build with -ffast-math, which
+// may optimise the compensation away
+struct KahanSum {
+  float sum = 0.0f;
+  float compensation = 0.0f;
+
+  void add(float value) {
+    float y = value - compensation;
+    float t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+  }
+
+  void reset() {
+    sum = 0.0f;
+    compensation = 0.0f;
+  }
+};
+
+#endif
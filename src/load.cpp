@@ -0,0 +1,35 @@
+#include "load.h"
+
+#include "config.h"
+#include "mbed.h"
+
+static uint32_t windowStartUs = 0;
+static uint32_t idleStartUs = 0;
+static uint32_t idleUs = 0;
+static float load = 0.0f;
+
+void loadIdleBegin() { idleStartUs = us_ticker_read(); }
+
+void loadIdleEnd() {
+  uint32_t now = us_ticker_read();
+  idleUs += now - idleStartUs;
+  uint32_t elapsed = now - windowStartUs;
+  if (elapsed < LOAD_WINDOW_US) {
+    return;
+  }
+  float busy = 1.0f - (float)idleUs / (float)elapsed;
+  if (busy < 0.0f) {
+    busy = 0.0f;
+  }
+  load += LOAD_SMOOTHING * (busy - load);
+  windowStartUs = now;
+  idleUs = 0;
+}
+
+void resetLoad() {
+  windowStartUs = us_ticker_read();
+  idleUs = 0;
+  load = 0.0f;
+}
+
+float cpuLoad() { return load; }
@@ -0,0 +1,17 @@
+#ifndef __LOAD_H
+#define __LOAD_H
+
+// CPU load of the acquisition loop, from the time it spends waiting for the
+// gyro: everything else (processing, SPI, drawing) counts as busy
+
+// Bracket the wait for the next sample
+void loadIdleBegin();
+void loadIdleEnd();
+
+// Start over, e.g. after sleeping, which would otherwise count as busy
+void resetLoad();
+
+// Busy fraction (0..1), smoothed over a few LOAD_WINDOW_US windows
+float cpuLoad();
+
+#endif
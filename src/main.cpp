@@ -1,54 +1,71 @@
 
 #include "drivers/LCD_DISCO_F429ZI.h"
+#include "drivers/bitmap_pack.h"
+#include "activity.h"
+#include "capture.h"
+#include "config.h"
+#include "dashboard.h"
+#include "gaitbands.h"
+#include "history.h"
+#include "load.h"
 #include "mbed.h"
-
-// Define Regs & Configurations --> Gyroscope's settings
-#define CTRL_REG1 0x20
-#define CTRL_REG1_CONFIG 0b01'10'1'1'1'1
-#define CTRL_REG4 0x23  // Second configure to set the DPS // page 33
-#define CTRL_REG4_CONFIG 0b0'0'01'0'00'0
-
-#define CTRL_REG3 0x22  // page 32
-#define CTRL_REG3_CONFIG 0b0'0'0'0'1'000
-
-#define OUT_X_L 0x28
+#include "odr.h"
+#include "orientation.h"
+#include "outlier.h"
+#include "power.h"
+#include "principal.h"
+#include "session.h"
+#include "spectrum.h"
+#include "stepdetect.h"
+#include "stridemodel.h"
+#include "tempcomp.h"
+#include "touch.h"
+#include "uischedule.h"
+#include "widgets.h"
+#include "zupt.h"
 
 #define SPI_FLAG 1
 #define DATA_READY_FLAG 2
+#define BUTTON_FLAG 4
+#define TOUCH_FLAG 8
 
-#define SCALING_FACTOR (17.5f * 0.017453292519943295769236907684886f / 1000.0f)
-
-#define FILTER_COEFFICIENT 0.1f
+#define FILTER_COEFFICIENT NOISE_FILTER_COEFFICIENT
 
 #define SAMPLE_INTERVAL_MS 500  // 0.5 seconds in milliseconds
 #define SAMPLE_COUNT 40         // Number of samples to store
 
-#define X 0
-#define Y 1
-#define Z 2
-
-// Set to 1 to enable debug messages in serrial monitor and to use teleplot
-#define DEBUG 0
-
-#define DISTANCE_TOLERANCE 0.02f
-
 LCD_DISCO_F429ZI lcd;  // Instantiate LCD object
 
 InterruptIn button(PA_0);  // Blue button
-Timer pressTimer;          // Timer to measure press duration
+LowPowerTimer pressTimer;  // Press duration; a Timer would block deep sleep
 
 volatile bool buttonPressed = false;
 volatile int pressDuration = 0;
 int height = 100;
 
+// Height entry: a slider over the range, 1 cm steps either side of it, and
+// the button that starts acquisition
+static const Slider heightSlider = {20, 208, 200, HEIGHT_MIN, HEIGHT_MAX};
+static const Button minusButton = {10, 248, 60, 48, "-"};
+static const Button startButton = {80, 248, 80, 48, "start"};
+static const Button plusButton = {170, 248, 60, 48, "+"};
+
 // Structure to hold gyro data
 struct GyroData {
   float gx, gy, gz;
+  float gp;  // about the principal axis of rotation
 };
 
-// Circular buffer for storing gyro data
+// Circular buffer for storing gyro data; a view of the last 20 s, totals are
+// kept by the session
 GyroData gyroBuffer[SAMPLE_COUNT];
 
+// Hours of the swing-axis rate at decreasing resolution, for range stats
+HistoryPyramid rateHistory;
+
+// Ticks per minute of history
+#define HISTORY_MINUTE (60000 / SAMPLE_INTERVAL_MS)
+
 // EventFlags object declaration
 EventFlags flags;
 
@@ -60,29 +77,26 @@ void data_cb() { flags.set(DATA_READY_FLAG); }
 
 int bufferIndex = 0;
 
+// Highest output data rate level allowed for each activity
+const int odrCeiling[] = {0, 2, 3, 2};
+
 // Function to add data to the buffer
-void addDataToBuffer(float gx, float gy, float gz) {
+void addDataToBuffer(float gx, float gy, float gz, float gp) {
   gyroBuffer[bufferIndex].gx = gx;
   gyroBuffer[bufferIndex].gy = gy;
   gyroBuffer[bufferIndex].gz = gz;
+  gyroBuffer[bufferIndex].gp = gp;
   bufferIndex = (bufferIndex + 1) % SAMPLE_COUNT;
 }
 
 // Function to calculate velocity - Method 1
-float getVelocity(const uint8_t axis, float height) {
+float getVelocity(float legLength) {
   float avgVelocity = 0.0f;
-  if (bufferIndex < 1) {
-    return avgVelocity;
-  }
-  float legLength =
-      (height * 0.45f) /
-      100;  // Assume leg length is 45% of height and convert to meters
-  float prevValue = (axis == X) ? gyroBuffer[bufferIndex - 1].gx
-                                : (axis == Y) ? gyroBuffer[bufferIndex - 1].gy
-                                              : gyroBuffer[bufferIndex - 1].gz;
-  float currentValue = (axis == X) ? gyroBuffer[bufferIndex].gx
-                                   : (axis == Y) ? gyroBuffer[bufferIndex].gy
-                                                 : gyroBuffer[bufferIndex].gz;
+  // Two latest entries of the circular buffer
+  float prevValue =
+      gyroBuffer[(bufferIndex + SAMPLE_COUNT - 2) % SAMPLE_COUNT].gp;
+  float currentValue =
+      gyroBuffer[(bufferIndex + SAMPLE_COUNT - 1) % SAMPLE_COUNT].gp;
   avgVelocity = ((prevValue + currentValue) / 2) * legLength;
   return avgVelocity;
 }
@@ -103,92 +117,98 @@ void onRelease() {
   buttonPressed = false;
   pressTimer.stop();
   pressDuration = pressTimer.read_ms();
+  flags.set(BUTTON_FLAG);
 }
 
 void updateDisplay(int height) {
-  char buffer[64];
-  snprintf(buffer, sizeof(buffer), "input height: %d cm", height);
   // lcd.Clear(LCD_COLOR_WHITE);
-  lcd.DisplayStringAt(0, LINE(1), (uint8_t *)buffer, CENTER_MODE);
-}
-
-// Function to calculate variance for a given axis
-float calculateVariance(const uint8_t axis) {
-  float sum = 0.0f, sumSquared = 0.0f;
-  for (int i = 0; i < SAMPLE_COUNT; ++i) {
-    float value = (axis == X)
-                      ? gyroBuffer[i].gx
-                      : (axis == Y) ? gyroBuffer[i].gy : gyroBuffer[i].gz;
-    sum += value;
-    sumSquared += value * value;
-  }
-  float mean = sum / SAMPLE_COUNT;
-  return (sumSquared / SAMPLE_COUNT) - (mean * mean);
-}
-
-// Function to calculate total distance for a given axis
-float calculateTotalDistance(const uint8_t axis, float height) {
-  float totalDistance = 0.0f;
-  float legLength =
-      (height * 0.45f) /
-      100;  // Assume leg length is 45% of height and convert to meters
-  float totalAvgVelocity = 0.0f;
-  for (int i = 1; i < bufferIndex; ++i) {
-    float prevValue =
-        (axis == X) ? gyroBuffer[i - 1].gx
-                    : (axis == Y) ? gyroBuffer[i - 1].gy : gyroBuffer[i - 1].gz;
-    float currentValue =
-        (axis == X) ? gyroBuffer[i].gx
-                    : (axis == Y) ? gyroBuffer[i].gy : gyroBuffer[i].gz;
-    // convert to average linear velocity
-    float avgVelocity = ((prevValue + currentValue) / 2) * legLength;
-    // sum up the average linear velocity
-    totalAvgVelocity += avgVelocity;
-  }
-  // calculate total distance
-  // v = d/t --> d = v * t
-  // t = SAMPLE_INTERVAL_MS * bufferIndex / 1000
-  // d = (total v / bufferIndex) * (SAMPLE_INTERVAL_MS * bufferIndex / 1000)
-  // d = (total v * SAMPLE_INTERVAL_MS) / 1000
-  totalDistance = (totalAvgVelocity * SAMPLE_INTERVAL_MS) / 1000;
-  // ignore noise
-  if (totalDistance <= DISTANCE_TOLERANCE) {
-    totalDistance = 0.0f;
-  }
-  return std::abs(totalDistance);
+  drawInt(lcd, 1, "input height", height, "cm");
+  drawSlider(lcd, heightSlider, height);
 }
 
 // Function to display 20s of angular velocity data in the buffer
 // We store absolute values of angular velocity in the buffer
 void displayBuffer() {
   for (int i = 0; i < SAMPLE_COUNT; ++i) {
-    printf("gyroBuffer[%d]: gx = %.2f, gy = %.2f, gz = %.2f\n", i,
-           gyroBuffer[i].gx, gyroBuffer[i].gy, gyroBuffer[i].gz);
+    printf("gyroBuffer[%d]: gx = %.2f, gy = %.2f, gz = %.2f, gp = %.2f\n", i,
+           gyroBuffer[i].gx, gyroBuffer[i].gy, gyroBuffer[i].gz,
+           gyroBuffer[i].gp);
   }
 }
 
 int main() {
   lcd.Clear(LCD_COLOR_WHITE);
+  lcd.DrawPackedBitmap(0, LINE(3), &Bitmap_splash);
+  drawButton(lcd, minusButton);
+  drawButton(lcd, startButton);
+  drawButton(lcd, plusButton);
 
   button.fall(&onPress);
   button.rise(&onRelease);
   pressTimer.start();
+  initTouch(flags, TOUCH_FLAG);
   updateDisplay(height);
 
-  while (true) {
-    if (!buttonPressed && pressDuration > 0) {
+  TouchEvent touch;
+  bool dragging = false;
+  bool entered = false;
+  int previousHeight;
+  uint32_t events;
+
+  while (!entered) {
+    // Sleep until the blue button is released or the screen is touched
+    events = flags.wait_any(BUTTON_FLAG | TOUCH_FLAG);
+    previousHeight = height;
+
+    // The slider follows a finger that landed on it; buttons take a tap
+    // for 1 cm and a long press for 10 cm, like the blue button
+    while ((events & TOUCH_FLAG) && nextTouchEvent(&touch)) {
+      switch (touch.type) {
+        case TOUCH_DOWN:
+          dragging = sliderHit(heightSlider, touch.x, touch.y);
+          // fall through
+        case TOUCH_MOVE:
+          if (dragging) {
+            height = sliderValue(heightSlider, touch.x);
+          }
+          break;
+        case TOUCH_UP:
+          dragging = false;
+          break;
+        case TOUCH_TAP:
+        case TOUCH_LONG_PRESS: {
+          int step = touch.type == TOUCH_TAP ? 1 : 10;
+          if (buttonHit(minusButton, touch.x, touch.y)) {
+            height -= step;
+          } else if (buttonHit(plusButton, touch.x, touch.y)) {
+            height += step;
+          } else if (buttonHit(startButton, touch.x, touch.y)) {
+            entered = true;
+          }
+          break;
+        }
+        default:
+          break;
+      }
+    }
+
+    if ((events & BUTTON_FLAG) && !buttonPressed && pressDuration > 0) {
       if (pressDuration < 500) {
         height += 1;
       } else if (pressDuration >= 500 && pressDuration < 2000) {
         height += 10;
       } else {
-        break;  // Exit the loop if press duration is 2000 ms or more
+        entered = true;  // a press of 2000 ms or more accepts the height
       }
       pressDuration = 0;
+    }
+
+    height = std::min(std::max(height, HEIGHT_MIN), HEIGHT_MAX);
+    if (height != previousHeight) {
       updateDisplay(height);
     }
-    ThisThread::sleep_for(10ms);
   }
+  initDashboard(lcd);
 
   // spi initialization
   SPI spi(PF_9, PF_8, PF_7, PC_1, use_gpio_ssel);
@@ -220,6 +240,19 @@ int main() {
 
   write_buf[1] = 0xFF;
 
+  initTempComp();
+  initStrideModel(height);
+  const float legLength = strideLegLength();
+  initSpectrum();
+  if (DEBUG) {
+    float fftError = spectrumSelfTest();
+    if (fftError < 0.0f) {
+      printf("fft self test: not run, portable fft only\n");
+    } else {
+      printf("fft self test: %f\n", fftError);
+    }
+  }
+
   //(polling for\setting) data ready flag
   if (!(flags.get() & DATA_READY_FLAG) && (int2.read() == 1)) {
     flags.set(DATA_READY_FLAG);
@@ -228,43 +261,173 @@ int main() {
   Timer sampleTimer;
   sampleTimer.start();
 
+  bool readTemp;
+  int length;
+  uint8_t *data;
   int16_t raw_gx;
   int16_t raw_gy;
   int16_t raw_gz;
-  uint8_t axis;
+  float gp;
+  StepEvent step;
+  bool stride;
+  bool moving;
+  float stepDistance;
+  float swingAngle;
+  float strideDistance;
+  float sampleDistance;
+  float dt;
+  uint64_t lastSampleUs = 0;
   float gx;
   float gy;
   float gz;
-  float filtered_gx;
-  float filtered_gy;
-  float filtered_gz;
-  float linear_velocity;
+  float filtered_gx = 0.0f;
+  float filtered_gy = 0.0f;
+  float filtered_gz = 0.0f;
+  float filtered_gp = 0.0f;
+  float linear_velocity = 0.0f;
   float distance;
-  float time;
-  float varX;
-  float varY;
-  float varZ;
-  int i;
+  DashboardValues dashboard;
+
+  // Hand what the dashboard shows to the frame scheduler
+  auto publish = [&]() {
+    dashboard.height = height;
+    dashboard.gx = filtered_gx;
+    dashboard.gy = filtered_gy;
+    dashboard.gz = filtered_gz;
+    dashboard.velocity = linear_velocity;
+    dashboard.distance = sessionDistance();
+    dashboard.time = sessionTime();
+    dashboard.steps = sessionSteps();
+    dashboard.cadence = stepCadence();
+    dashboard.activity = activityName(currentActivity());
+    dashboard.calibrating = calibrating();
+    dashboard.calibrationStrides = calibrationStrides();
+    dashboard.minutes = std::min(sessionMinutes(), DASHBOARD_MINUTES);
+    for (int i = 0; i < dashboard.minutes; i++) {
+      dashboard.minuteDistance[i] = sessionMinute(i).distanceCm * 0.01f;
+    }
+    publishUi(dashboard);
+  };
+  // A calibration walk starts on the first request and is finished at the
+  // end of the CALIBRATION_DISTANCE course by the next
+  auto toggleCalibration = [&]() {
+    if (calibrating()) {
+      finishCalibration(CALIBRATION_DISTANCE);
+    } else {
+      startCalibration();
+    }
+    publish();
+    requestUiFrame();  // show it right away
+  };
+  // While still, the values barely change: few frames are needed
+  setUiFrameRate(UI_STILL_FRAME_RATE);
+  resetLoad();
 
   // char buffer[32]; // Buffer for string conversion
 
   while (1) {
-    char lineBuffer[128];  // Increased buffer size for floating-point numbers
-    flags.wait_all(DATA_READY_FLAG);
-    write_buf[0] = OUT_X_L | 0x80 | 0x40;
-
-    spi.transfer(write_buf, 7, read_buf, 7, spi_cb);
+    // Bounded wait: a data ready edge can be missed while the gyro switches
+    // modes, and reading the output registers re-arms it
+    loadIdleBegin();
+    flags.wait_all_for(DATA_READY_FLAG, WAKE_LATENCY_MS * 1ms);
+    loadIdleEnd();
+    // Now and then start the burst two registers early to also get
+    // OUT_TEMP (and STATUS) in the same transfer. Captures skip it: they
+    // never reach compensateBias, so it would be due on every burst
+    readTemp = !CAPTURE_RAW && temperatureDue();
+    write_buf[0] = (readTemp ? OUT_TEMP : OUT_X_L) | 0x80 | 0x40;
+    length = readTemp ? 9 : 7;
+
+    spi.transfer(write_buf, length, read_buf, length, spi_cb);
     flags.wait_all(SPI_FLAG);
 
+    if (readTemp) {
+      updateTemperature((int8_t)read_buf[1]);
+    }
+    data = readTemp ? read_buf + 2 : read_buf;
+
     // Process raw data
-    raw_gx = (((uint16_t)read_buf[2]) << 8) | ((uint16_t)read_buf[1]);
-    raw_gy = (((uint16_t)read_buf[4]) << 8) | ((uint16_t)read_buf[3]);
-    raw_gz = (((uint16_t)read_buf[6]) << 8) | ((uint16_t)read_buf[5]);
+    raw_gx = (((uint16_t)data[2]) << 8) | ((uint16_t)data[1]);
+    raw_gy = (((uint16_t)data[4]) << 8) | ((uint16_t)data[3]);
+    raw_gz = (((uint16_t)data[6]) << 8) | ((uint16_t)data[5]);
+
+    if (CAPTURE_RAW) {
+      // Stream the sensor as it is: no bias table, default rate throughout
+      captureSample(raw_gx, raw_gy, raw_gz, (int)odrHz());
+      continue;
+    }
+
+    compensateBias(&raw_gx, &raw_gy, &raw_gz);
+    saveTempComp();
 
     gx = ((float)raw_gx) * SCALING_FACTOR;
     gy = ((float)raw_gy) * SCALING_FACTOR;
     gz = ((float)raw_gz) * SCALING_FACTOR;
 
+    // Cut impact spikes before they reach the rate statistics and filters
+    rejectOutliers(&gx, &gy, &gz);
+
+    if (updateOdr(&gx, &gy, &gz)) {
+      // Switch right after a read so no sample straddles the change
+      write_buf[0] = CTRL_REG1;
+      write_buf[1] = odrRegister();
+      spi.transfer(write_buf, 2, read_buf, 2, spi_cb);
+      flags.wait_all(SPI_FLAG);
+      write_buf[1] = 0xFF;
+    }
+
+    // Project onto the swing axis; stride detection runs on every sample,
+    // so its threshold and cadence are current by the time the classifier
+    // sees the walk, and the first strides still count
+    gp = updatePrincipalAxis(gx, gy, gz, odrPeriod());
+    stride = updateStepDetector(gp, odrTimestampUs(), &step);
+    moving = currentActivity() != ACTIVITY_STILL;
+    stepDistance = updateZupt(gp, odrPeriod(), legLength);
+
+    // Orientation integrates the measured interval, on the timestamps'
+    // timeline: a loop delayed by a frame or a flash erase is integrated
+    // over, and the first sample (after a reset too) gets one period
+    dt = (odrTimestampUs() - lastSampleUs) * 1e-6f;
+    lastSampleUs = odrTimestampUs();
+    dt = std::min(dt, ORIENTATION_MAX_GAP * odrPeriod());
+    updateOrientation(gx, gy, gz, dt, zuptStance());
+
+    if (stride) {
+      swingAngle = takeSwingAngle();  // also starts the next swing
+    }
+    // Stride lengths only while the user is moving
+    if (stride && moving) {
+      strideDistance = strideModelLength(swingAngle, step.cadence);
+      calibrationStride(swingAngle, step.cadence);
+      if (DEBUG) {
+        printf(">cadence: %4.1f |g\n", step.cadence);
+        printf(">swing: %4.2f |g\n", step.amplitude);
+        printf(">swing angle: %4.2f |g\n", swingAngle);
+        printf(">stride length: %4.2f |g\n", strideDistance);
+      }
+    }
+    // While moving, distance comes in whole strides from the stride model;
+    // while still, the ZUPT integral keeps the slow motion strides miss
+    sampleDistance = stride && moving ? strideDistance : 0.0f;
+    if (!moving) {
+      sampleDistance = stepDistance;
+    }
+    updateSession(sampleDistance, odrTimestampUs(), stride);
+    if (stride) {
+      publish();  // steps and distance move on without waiting for the tick
+    }
+    updateGaitBands(gp, odrTimestampUs());
+    if (updateActivity(gp, odrTimestampUs())) {
+      setOdrCeiling(odrCeiling[currentActivity()]);
+      setUiFrameRate(currentActivity() == ACTIVITY_STILL ? UI_STILL_FRAME_RATE
+                                                         : UI_FRAME_RATE);
+    }
+    if (updateSpectrum(gp, odrTimestampUs()) && DEBUG) {
+      printf(">fft cadence: %4.1f |g\n", spectrumCadence());
+      printf(">gait band: %4.2f |g\n", spectrumBandEnergy());
+      printf(">goertzel peak: %4.2f |g\n", gaitBandPeak());
+    }
+
     if (sampleTimer.read_ms() >= SAMPLE_INTERVAL_MS) {
       filtered_gx =
           FILTER_COEFFICIENT * gx + (1 - FILTER_COEFFICIENT) * filtered_gx;
@@ -272,79 +435,86 @@ int main() {
           FILTER_COEFFICIENT * gy + (1 - FILTER_COEFFICIENT) * filtered_gy;
       filtered_gz =
           FILTER_COEFFICIENT * gz + (1 - FILTER_COEFFICIENT) * filtered_gz;
+      filtered_gp =
+          FILTER_COEFFICIENT * gp + (1 - FILTER_COEFFICIENT) * filtered_gp;
       // Reset the timer
       sampleTimer.reset();
       if (DEBUG) {
         printf(">gx: %4.2f |g\n", filtered_gx);
         printf(">gy: %4.2f |g\n", filtered_gy);
         printf(">gz: %4.2f |g\n", filtered_gz);
+        printf(">gp: %4.2f |g\n", filtered_gp);
       }
 
       addDataToBuffer(std::abs(filtered_gx), std::abs(filtered_gy),
-                      std::abs(filtered_gz));
+                      std::abs(filtered_gz), std::abs(filtered_gp));
+      rateHistory.add(std::abs(filtered_gp));
 
-      // Calculate variance for each axis
-      varX = calculateVariance(X);
-      varY = calculateVariance(Y);
-      varZ = calculateVariance(Z);
-
-      // Determine the axis with the highest variance
-      axis = (varX > varY && varX > varZ) ? X : (varY > varZ) ? Y : Z;
-
-      linear_velocity = getVelocity(axis, height);
+      linear_velocity = getVelocity(legLength);
       // distance += getDistance(linear_velocity);
-      distance = calculateTotalDistance(axis, height);
+      distance = sessionDistance();
 
       if (DEBUG) {
         printf("distance: %f\n", distance);
+        printf("outliers: %u\n", (unsigned)outliersRejected());
+        printf(">cpu load: %4.2f |g\n", cpuLoad());
+        printf(">frame rate: %4.2f |g\n", uiFrameRate());
       }
 
-      // Clear the LCD screen before displaying new data
-      lcd.Clear(LCD_COLOR_WHITE);
-
-      snprintf(lineBuffer, sizeof(lineBuffer), "height: %d cm", height);
-      lcd.DisplayStringAt(0, LINE(4), (uint8_t *)lineBuffer, CENTER_MODE);
-
-      // Convert gx to string and display
-      snprintf(lineBuffer, sizeof(lineBuffer), "gx: %2.2f rad/s", filtered_gx);
-      lcd.DisplayStringAt(0, LINE(5), (uint8_t *)lineBuffer, CENTER_MODE);
-
-      // Convert gy to string and display
-      snprintf(lineBuffer, sizeof(lineBuffer), "gy: %2.2f rad/s", filtered_gy);
-      lcd.DisplayStringAt(0, LINE(6), (uint8_t *)lineBuffer, CENTER_MODE);
-
-      // Convert gz to string and display
-      snprintf(lineBuffer, sizeof(lineBuffer), "gz: %2.2f rad/s", filtered_gz);
-      lcd.DisplayStringAt(0, LINE(7), (uint8_t *)lineBuffer, CENTER_MODE);
+      // A long press starts or finishes a calibration walk
+      if (!buttonPressed && pressDuration > 0) {
+        if (pressDuration >= 2000) {
+          toggleCalibration();
+        }
+        pressDuration = 0;
+      }
 
-      // Convert linear velocity to string and display
-      snprintf(lineBuffer, sizeof(lineBuffer), "velocity: %2.2f m/s",
-               linear_velocity);
-      lcd.DisplayStringAt(0, LINE(8), (uint8_t *)lineBuffer, CENTER_MODE);
+      if (updateIdleState(filtered_gx, filtered_gy, filtered_gz)) {
+        // The sample timer holds a deep sleep lock while it runs
+        sampleTimer.stop();
+        sleepUntilMotion(spi);
+        resetOdr();
+        sampleTimer.reset();
+        sampleTimer.start();
+        resetLoad();
+      }
+      // Dump the buffer each time it wraps
+      if (DEBUG && bufferIndex == 0) {
+        displayBuffer();
+        for (int minutes : {1, 10, 60}) {
+          HistoryStats stats = rateHistory.latest(minutes * HISTORY_MINUTE);
+          printf("last %d min: mean %.2f, max %.2f, sd %.2f rad/s\n", minutes,
+                 stats.mean(), stats.max, sqrtf(stats.variance()));
+        }
+      }
 
-      // Convert distance to string and display
-      snprintf(lineBuffer, sizeof(lineBuffer), "distance: %2.2f m", distance);
-      lcd.DisplayStringAt(0, LINE(9), (uint8_t *)lineBuffer, CENTER_MODE);
+      publish();
+    }
 
-      // Convert distance to string and display
-      time = (SAMPLE_INTERVAL_MS * bufferIndex) / 1000.0f;
-      snprintf(lineBuffer, sizeof(lineBuffer), "time: %2.2fs", time);
-      lcd.DisplayStringAt(0, LINE(10), (uint8_t *)lineBuffer, CENTER_MODE);
-      if (time - 0.0f <= 0.0001) {
-        if (DEBUG) {
-          printf("reset\n");
-        }
-        // Display buffer to extract values before being wiped
-        displayBuffer();
-        distance = 0.0f;
-        bufferIndex = 0;
-        for (i = 0; i < SAMPLE_COUNT; ++i) {
-          gyroBuffer[i].gx = 0.0f;
-          gyroBuffer[i].gy = 0.0f;
-          gyroBuffer[i].gz = 0.0f;
+    // Gestures come ready made from the touch thread. Swipes turn the
+    // page; reset must be held, so a stray tap keeps the session
+    if (flags.get() & TOUCH_FLAG) {
+      flags.clear(TOUCH_FLAG);
+      while (nextTouchEvent(&touch)) {
+        DashboardControl control = dashboardControlAt(touch.x, touch.y);
+        if (touch.type == TOUCH_TAP && control == DASHBOARD_RECORD) {
+          toggleCalibration();
+        } else if (touch.type == TOUCH_LONG_PRESS &&
+                   control == DASHBOARD_RESET) {
+          resetSession();
+          publish();
+          requestUiFrame();
+        } else if (touch.type == TOUCH_SWIPE_LEFT ||
+                   touch.type == TOUCH_SWIPE_RIGHT) {
+          int step = touch.type == TOUCH_SWIPE_LEFT ? 1 : -1;
+          setDashboardPage(lcd, dashboardPage() + step);
+          publish();
+          requestUiFrame();
         }
       }
     }
-    thread_sleep_for(100);
+
+    // Draw when a frame is due; its values are the latest published
+    serviceUi(lcd);
   }
 }
\ No newline at end of file
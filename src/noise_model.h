@@ -0,0 +1,12 @@
+// Generated by tools/allan.py, do not edit
+// Constants: baseline, hand-tuned
+#ifndef __NOISE_MODEL_H
+#define __NOISE_MODEL_H
+
+#define NOISE_FILTER_COEFFICIENT 0.1f
+#define NOISE_WAKE_THRESHOLD 0.5f
+#define NOISE_TEMP_STILL_VARIANCE 400
+#define NOISE_ZUPT_THRESHOLD 0.05f
+#define NOISE_OUTLIER_FLOOR 0.5f
+
+#endif
@@ -0,0 +1,141 @@
+#include "odr.h"
+
+#include <cmath>
+#include <stdio.h>
+
+#include "config.h"
+#include "mbed.h"
+
+#define ODR_LEVELS 4
+
+// Output data rates (Hz) and the matching CTRL_REG1 values: DR and BW bits
+// with a cut-off around a quarter of the rate, power on and all axes enabled
+static const float odrRates[ODR_LEVELS] = {95.0f, 190.0f, 380.0f, 760.0f};
+// Nominal sample periods in microseconds, for the first timestamp
+static const uint32_t odrPeriodsUs[ODR_LEVELS] = {10526, 5263, 2632, 1316};
+static const uint8_t odrConfigs[ODR_LEVELS] = {
+    0b00'01'1'1'1'1,  // 95 Hz, 25 Hz cut-off
+    0b01'10'1'1'1'1,  // 190 Hz, 50 Hz cut-off (CTRL_REG1_CONFIG)
+    0b10'11'1'1'1'1,  // 380 Hz, 100 Hz cut-off
+    0b11'11'1'1'1'1,  // 760 Hz, 100 Hz cut-off
+};
+
+static int level = ODR_DEFAULT_LEVEL;
+static int ceiling = ODR_LEVELS - 1;
+static int settleCount = 0;
+static int evalCount = 0;
+static float dwell = 0.0f;
+static uint64_t timestampUs = 0;
+static uint32_t lastTickUs = 0;
+static bool ticking = false;
+
+static float period = 1.0f / 190.0f;
+static float alpha = 1.0f / (ODR_TIME_CONSTANT * 190.0f);
+static float mean[3];
+static float prev[3];
+static float variance = 0.0f;
+static float diffVariance = 0.0f;
+
+static void setLevel(int newLevel) {
+  level = newLevel;
+  settleCount = ODR_SETTLE_SAMPLES;
+  dwell = 0.0f;
+  period = 1.0f / odrRates[level];
+  // Keep the averaging window constant in time, not in samples
+  alpha = 1.0f / (ODR_TIME_CONSTANT * odrRates[level]);
+}
+
+// Pick the slowest rate that still oversamples the signal enough
+static int chooseLevel() {
+  if (variance < ODR_VARIANCE_QUIET) {
+    return 0;
+  }
+  // Parseval: E[x'^2] / E[x^2] = (2 pi f_rms)^2, with x' ~ diff * fs
+  float fRms = odrRates[level] * sqrtf(diffVariance / variance) /
+               (2.0f * 3.14159265f);
+  float required = ODR_OVERSAMPLING * fRms;
+
+  int wanted = 0;
+  while (wanted < ODR_LEVELS - 1 && odrRates[wanted] < required) {
+    wanted++;
+  }
+  // Hysteresis: only step down once the lower rate has ample headroom
+  if (wanted < level && required > ODR_DOWN_MARGIN * odrRates[level - 1]) {
+    wanted = level;
+  }
+  return wanted > ceiling ? ceiling : wanted;
+}
+
+bool updateOdr(float *gx, float *gy, float *gz) {
+  float sample[3] = {*gx, *gy, *gz};
+
+  // Time from the microsecond ticker rather than one period per read, so
+  // samples the loop was too busy to read (a frame, a flash erase) are not
+  // lost from the timeline
+  uint32_t now = us_ticker_read();
+  uint32_t elapsedUs = ticking ? now - lastTickUs : odrPeriodsUs[level];
+  lastTickUs = now;
+  ticking = true;
+  timestampUs += elapsedUs;
+  dwell += elapsedUs * 1e-6f;
+
+  if (settleCount > 0) {
+    // Hold the last good sample while the digital filters settle
+    settleCount--;
+    *gx = prev[0];
+    *gy = prev[1];
+    *gz = prev[2];
+    return false;
+  }
+
+  float var = 0.0f, diffVar = 0.0f;
+  for (int i = 0; i < 3; ++i) {
+    float d = sample[i] - prev[i];
+    mean[i] += alpha * (sample[i] - mean[i]);
+    float e = sample[i] - mean[i];
+    var += e * e;
+    diffVar += d * d;
+    prev[i] = sample[i];
+  }
+  variance += alpha * (var - variance);
+  diffVariance += alpha * (diffVar - diffVariance);
+
+  // The decision needs a square root, so only evaluate it now and then
+  if (++evalCount < ODR_EVAL_SAMPLES) {
+    return false;
+  }
+  evalCount = 0;
+
+  int wanted = chooseLevel();
+  if (wanted == level) {
+    return false;
+  }
+  // Speed up right away, but slow down only after the minimum dwell time
+  // unless the ceiling forces it
+  if (wanted < level && dwell < ODR_MIN_DWELL && level <= ceiling) {
+    return false;
+  }
+  if (DEBUG) {
+    printf("odr: %d Hz\n", (int)odrRates[wanted]);
+  }
+  setLevel(wanted);
+  return true;
+}
+
+void setOdrCeiling(int newCeiling) { ceiling = newCeiling; }
+
+void resetOdr() {
+  setLevel(ODR_DEFAULT_LEVEL);
+  // Leave the idle time out: the timeline goes on from the next sample
+  ticking = false;
+  variance = 0.0f;
+  diffVariance = 0.0f;
+}
+
+uint8_t odrRegister() { return odrConfigs[level]; }
+
+float odrHz() { return odrRates[level]; }
+
+float odrPeriod() { return period; }
+
+uint64_t odrTimestampUs() { return timestampUs; }
@@ -0,0 +1,29 @@
+#ifndef __ODR_H
+#define __ODR_H
+
+#include <stdint.h>
+
+// Feed one gyro sample (rad/s) to the output data rate controller. While the
+// gyro settles after a rate change the sample is replaced by the last good
+// one. Returns true when CTRL_REG1 must be rewritten with odrRegister()
+bool updateOdr(float *gx, float *gy, float *gz);
+
+// Highest rate (0 = 95 Hz .. 3 = 760 Hz) the controller may pick, so callers
+// can keep the high rates for when they are needed
+void setOdrCeiling(int ceiling);
+
+// Go back to the default rate (CTRL_REG1_CONFIG), e.g. after idle
+void resetOdr();
+
+// CTRL_REG1 value for the current rate and bandwidth
+uint8_t odrRegister();
+
+// Current output data rate in Hz and sample period in seconds
+float odrHz();
+float odrPeriod();
+
+// Time of the last sample in microseconds, from the microsecond ticker:
+// continuous across rate changes and missed samples, with idle left out
+uint64_t odrTimestampUs();
+
+#endif
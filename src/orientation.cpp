@@ -0,0 +1,66 @@
+#include "orientation.h"
+
+#include <cmath>
+
+#include "config.h"
+#include "principal.h"
+
+static float q[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+
+// tan(angle / 2) about the swing axis is monotonic in the angle, so its
+// extremes can be tracked per sample with a division instead of atan2
+static float minHalfTan = 0.0f;
+static float maxHalfTan = 0.0f;
+
+void updateOrientation(float gx, float gy, float gz, float dt, bool stance) {
+  if (stance) {
+    q[0] = 1.0f;
+    q[1] = q[2] = q[3] = 0.0f;
+    return;
+  }
+
+  // q += 0.5 * q (x) (0, w) * dt
+  float hx = 0.5f * dt * gx, hy = 0.5f * dt * gy, hz = 0.5f * dt * gz;
+  float w = q[0], x = q[1], y = q[2], z = q[3];
+  q[0] = w - x * hx - y * hy - z * hz;
+  q[1] = x + w * hx + y * hz - z * hy;
+  q[2] = y + w * hy - x * hz + z * hx;
+  q[3] = z + w * hz + x * hy - y * hx;
+
+  // Renormalise only once the norm has drifted, and then with the first
+  // order 1 / sqrt(n) ~ (3 - n) / 2, which is exact enough that close to 1
+  float n = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
+  if (std::abs(n - 1.0f) > ORIENTATION_NORM_TOLERANCE) {
+    float scale = 0.5f * (3.0f - n);
+    for (int i = 0; i < 4; ++i) {
+      q[i] *= scale;
+    }
+  }
+
+  float axis[3];
+  principalAxis(axis);
+  float sinHalf = q[1] * axis[0] + q[2] * axis[1] + q[3] * axis[2];
+  if (q[0] > 0.0f) {
+    float halfTan = sinHalf / q[0];
+    minHalfTan = halfTan < minHalfTan ? halfTan : minHalfTan;
+    maxHalfTan = halfTan > maxHalfTan ? halfTan : maxHalfTan;
+  }
+}
+
+float takeSwingAngle() {
+  float angle = 2.0f * (atanf(maxHalfTan) - atanf(minHalfTan));
+  minHalfTan = maxHalfTan = 0.0f;
+  return angle;
+}
+
+// The shank swings as a pendulum: each step moves the foot by the chord
+// 2 L sin(angle / 2), and a stride is two steps
+float strideLength(float swingAngle, float legLength) {
+  return 4.0f * legLength * sinf(0.5f * swingAngle);
+}
+
+void orientation(float out[4]) {
+  for (int i = 0; i < 4; ++i) {
+    out[i] = q[i];
+  }
+}
@@ -0,0 +1,19 @@
+#ifndef __ORIENTATION_H
+#define __ORIENTATION_H
+
+// Integrate one gyro sample (rad/s) over the measured dt (s) into the shank
+// orientation. stance resets the reference to the current pose, which keeps
+// drift bounded to a single stride. No trig in this path
+void updateOrientation(float gx, float gy, float gz, float dt, bool stance);
+
+// Range (rad) of rotation about the swing axis since the previous call,
+// i.e. the swing angle of the stride that just ended
+float takeSwingAngle();
+
+// Stride length (m) a leg of the given length covers with that swing angle
+float strideLength(float swingAngle, float legLength);
+
+// Current orientation quaternion (w, x, y, z) relative to the last stance
+void orientation(float q[4]);
+
+#endif
@@ -0,0 +1,31 @@
+#include "outlier.h"
+
+#include "config.h"
+#include "robust.h"
+
+static SlidingMinMax<OUTLIER_WINDOW> range[3];
+static RunningMedian<OUTLIER_WINDOW> median[3];
+static uint32_t rejected = 0;
+
+void rejectOutliers(float *gx, float *gy, float *gz) {
+  float *axes[3] = {gx, gy, gz};
+
+  for (int i = 0; i < 3; ++i) {
+    float x = *axes[i];
+    bool spike = false;
+    if (range[i].full()) {
+      // Compare against the window before x joins it
+      float margin =
+          OUTLIER_MARGIN * (range[i].max() - range[i].min()) + OUTLIER_FLOOR;
+      spike = x > range[i].max() + margin || x < range[i].min() - margin;
+    }
+    range[i].push(x);
+    median[i].push(x);
+    if (spike) {
+      *axes[i] = median[i].median();
+      rejected++;
+    }
+  }
+}
+
+uint32_t outliersRejected() { return rejected; }
@@ -0,0 +1,15 @@
+#ifndef __OUTLIER_H
+#define __OUTLIER_H
+
+#include <stdint.h>
+
+// Feed one gyro sample (rad/s). A value far outside the range of the last
+// OUTLIER_WINDOW samples on its axis, such as an impact spike at heel
+// strike, is replaced by the window median. A real change of level gets
+// through one sample later, once it is part of the window
+void rejectOutliers(float *gx, float *gy, float *gz);
+
+// Values replaced so far
+uint32_t outliersRejected();
+
+#endif
@@ -0,0 +1,120 @@
+#include "persist.h"
+
+#include "mbed.h"
+
+// Bump whenever PersistentData changes layout
+#define PERSIST_MAGIC 0x47595230  // "GYR0"
+#define PERSIST_VERSION 2
+
+#define WRITE_FLAG 1
+
+struct PersistentRecord {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;
+  uint32_t crc;
+  PersistentData data;
+};
+
+PersistentData persistent;
+
+static PersistentRecord record;
+
+// Background writes: the settings as they were when the write was asked for
+static PersistentData pending;
+static volatile bool writing = false;
+// One writer of record and the sector at a time
+static Mutex flashMutex;
+static EventFlags writeRequest;
+static Thread writerThread(osPriorityLow, PERSIST_STACK_SIZE, nullptr,
+                           "persist");
+static bool writerStarted = false;
+
+static uint32_t checksum(const PersistentData *data) {
+  MbedCRC<POLY_32BIT_ANSI, 32> crc32;
+  uint32_t crc = 0;
+  crc32.compute(data, sizeof(PersistentData), &crc);
+  return crc;
+}
+
+// The last sector of the flash, kept out of the image by target.mbed_rom_size
+// in mbed_app.json. 0 if the image reaches into it all the same
+static uint32_t sectorAddress(FlashIAP &flash) {
+  uint32_t end = flash.get_flash_start() + flash.get_flash_size();
+  uint32_t address = end - flash.get_sector_size(end - 1);
+  return address >= FLASHIAP_APP_ROM_END_ADDR ? address : 0;
+}
+
+void loadPersistentData() {
+  FlashIAP flash;
+  flash.init();
+  uint32_t address = sectorAddress(flash);
+  int result = address ? flash.read(&record, address, sizeof(record)) : -1;
+  flash.deinit();
+
+  if (result == 0 && record.magic == PERSIST_MAGIC &&
+      record.version == PERSIST_VERSION &&
+      record.size == sizeof(PersistentData) &&
+      record.crc == checksum(&record.data)) {
+    persistent = record.data;
+  } else {
+    memset(&persistent, 0, sizeof(persistent));
+  }
+}
+
+// Erase the sector and program it with data; caller holds flashMutex
+static int writeRecord(const PersistentData &data) {
+  record.magic = PERSIST_MAGIC;
+  record.version = PERSIST_VERSION;
+  record.size = sizeof(PersistentData);
+  record.data = data;
+  record.crc = checksum(&record.data);
+
+  FlashIAP flash;
+  flash.init();
+  uint32_t address = sectorAddress(flash);
+  int result = -1;
+  if (address) {
+    result = flash.erase(address, flash.get_sector_size(address));
+  }
+  if (result == 0) {
+    result = flash.program(&record, address, sizeof(record));
+  }
+  flash.deinit();
+
+  if (DEBUG) {
+    printf("settings saved: %d\n", result);
+  }
+  return result;
+}
+
+bool savePersistentData() {
+  flashMutex.lock();
+  int result = writeRecord(persistent);
+  flashMutex.unlock();
+  return result == 0;
+}
+
+static void writerLoop() {
+  for (;;) {
+    writeRequest.wait_any(WRITE_FLAG);
+    flashMutex.lock();
+    writeRecord(pending);
+    flashMutex.unlock();
+    writing = false;
+  }
+}
+
+bool savePersistentDataInBackground() {
+  if (writing) {
+    return false;
+  }
+  if (!writerStarted) {
+    writerThread.start(writerLoop);
+    writerStarted = true;
+  }
+  pending = persistent;
+  writing = true;
+  writeRequest.set(WRITE_FLAG);
+  return true;
+}
@@ -0,0 +1,36 @@
+#ifndef __PERSIST_H
+#define __PERSIST_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+// Settings learned on the device and kept in the last flash sector
+struct PersistentData {
+  // Zero-rate level per axis and temperature bin, in raw LSB
+  float tempBias[TEMP_BINS][3];
+  // Number of still blocks folded into each bin (saturates)
+  uint8_t tempBiasBlocks[TEMP_BINS];
+  // Stride model coefficients and their covariance, see stridemodel.cpp
+  float strideCoefficients[3];
+  float strideCovariance[3][3];
+  // Calibration walks folded into the fit; 0 means use the defaults
+  uint8_t strideWalks;
+};
+
+extern PersistentData persistent;
+
+// Load the stored settings, or zeroed defaults if none are valid
+void loadPersistentData();
+
+// Write the settings back; erases a flash sector, so call it rarely. The
+// 128 KB sector takes one to two seconds to erase, all of it in this call
+bool savePersistentData();
+
+// The same without the wait: copies the settings and leaves the erase and
+// the programming to a low priority thread. The sector is in the second
+// flash bank, so the code keeps running from the first meanwhile. false,
+// with nothing copied, while the previous write is still going on
+bool savePersistentDataInBackground();
+
+#endif
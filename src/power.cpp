@@ -0,0 +1,147 @@
+#include "power.h"
+
+#include "config.h"
+#include "drivers/l3gd20.h"
+#include "drivers/stm32f429i_discovery_lcd.h"
+
+#define WAKE_FLAG 1
+
+// INT1_CFG: latch the request and OR together the X/Y/Z high events
+#define INT1_CFG_CONFIG 0b0'1'10'10'10
+// INT1_DURATION: WAIT bit, so short spikes (heel strikes) do not count
+#define INT1_DURATION_CONFIG (0x80 | WAKE_DURATION)
+// CTRL_REG5: enable the high-pass filter and feed it to INT1 only, so the
+// zero-rate level does not trip the threshold
+#define CTRL_REG5_IDLE_CONFIG 0b0'0'0'1'01'00
+// CTRL_REG1: slowest ODR (95 Hz) and bandwidth that still drives INT1
+#define CTRL_REG1_IDLE_CONFIG                                      \
+  (L3GD20_OUTPUT_DATARATE_1 | L3GD20_BANDWIDTH_1 | L3GD20_MODE_ACTIVE | \
+   L3GD20_AXES_ENABLE)
+
+// INT1 of the gyro is wired to PA1 on the discovery board
+static InterruptIn int1(PA_1, PullDown);
+static EventFlags wakeFlags;
+
+static int stillTicks = 0;
+
+static void int1_cb() { wakeFlags.set(WAKE_FLAG); }
+
+bool updateIdleState(float gx, float gy, float gz) {
+  if (std::abs(gx) < WAKE_THRESHOLD && std::abs(gy) < WAKE_THRESHOLD &&
+      std::abs(gz) < WAKE_THRESHOLD) {
+    stillTicks++;
+  } else {
+    stillTicks = 0;
+  }
+  return stillTicks >= IDLE_TICKS;
+}
+
+// Send a single command to the SDRAM holding the frame buffers
+static void sdramCommand(uint32_t mode) {
+  FMC_SDRAM_CommandTypeDef command;
+  command.CommandMode = mode;
+  command.CommandTarget = FMC_SDRAM_CMD_TARGET_BANK2;
+  command.AutoRefreshNumber = 1;
+  command.ModeRegisterDefinition = 0;
+  BSP_SDRAM_Sendcmd(&command);
+}
+
+// Register access through the acquisition loop's SPI (mode 3, GPIO chip
+// select). The BSP gyro functions would drive SPI5 through the HAL in mode
+// 0 and re-initialise its pins under mbed
+static void writeRegisters(SPI &spi, uint8_t reg, const uint8_t *values,
+                           int length) {
+  char tx[8];
+  // Bit 6 auto-increments the address over a burst
+  tx[0] = (char)(reg | (length > 1 ? 0x40 : 0x00));
+  for (int i = 0; i < length; ++i) {
+    tx[i + 1] = (char)values[i];
+  }
+  spi.write(tx, length + 1, nullptr, 0);
+}
+
+static void writeRegister(SPI &spi, uint8_t reg, uint8_t value) {
+  writeRegisters(spi, reg, &value, 1);
+}
+
+static uint8_t readRegister(SPI &spi, uint8_t reg) {
+  char tx[2] = {(char)(reg | 0x80), 0};
+  char rx[2];
+  spi.write(tx, 2, rx, 2);
+  return (uint8_t)rx[1];
+}
+
+static void configureWakeOnMotion(SPI &spi) {
+  uint8_t threshold[6];
+  // Thresholds are 15 bit, in the same units as the output registers
+  uint16_t raw = (uint16_t)(WAKE_THRESHOLD / SCALING_FACTOR) & 0x7FFF;
+
+  // Stop data ready interrupts so they do not keep waking the MCU
+  writeRegister(spi, L3GD20_CTRL_REG3_ADDR, 0x00);
+
+  for (int i = 0; i < 3; ++i) {
+    threshold[2 * i] = (uint8_t)(raw >> 8);
+    threshold[2 * i + 1] = (uint8_t)raw;
+  }
+  writeRegisters(spi, L3GD20_INT1_TSH_XH_ADDR, threshold, 6);
+  writeRegister(spi, L3GD20_INT1_DURATION_ADDR, INT1_DURATION_CONFIG);
+
+  writeRegister(spi, L3GD20_CTRL_REG2_ADDR,
+                L3GD20_HPM_NORMAL_MODE | L3GD20_HPFCF_6);
+  writeRegister(spi, L3GD20_CTRL_REG5_ADDR, CTRL_REG5_IDLE_CONFIG);
+
+  // INT1 active high (H_Lactive clear), driven by the high events
+  writeRegister(spi, L3GD20_INT1_CFG_ADDR, INT1_CFG_CONFIG);
+  writeRegister(spi, L3GD20_CTRL_REG3_ADDR, L3GD20_INT1INTERRUPT_ENABLE);
+
+  writeRegister(spi, L3GD20_CTRL_REG1_ADDR, CTRL_REG1_IDLE_CONFIG);
+
+  // Clear any event latched while reconfiguring
+  readRegister(spi, L3GD20_INT1_SRC_ADDR);
+}
+
+static void restoreFullRate(SPI &spi) {
+  writeRegister(spi, L3GD20_CTRL_REG3_ADDR, 0x00);
+  readRegister(spi, L3GD20_INT1_SRC_ADDR);
+
+  writeRegister(spi, L3GD20_CTRL_REG5_ADDR, 0x00);
+
+  writeRegister(spi, L3GD20_CTRL_REG1_ADDR, CTRL_REG1_CONFIG);
+  writeRegister(spi, L3GD20_CTRL_REG3_ADDR, CTRL_REG3_CONFIG);
+}
+
+void sleepUntilMotion(SPI &spi) {
+  if (DEBUG) {
+    printf("idle\n");
+  }
+  stillTicks = 0;
+
+  configureWakeOnMotion(spi);
+
+  BSP_LCD_DisplayOff();
+  // Keep the frame buffers alive while the FMC clock is stopped
+  sdramCommand(FMC_SDRAM_CMD_SELFREFRESH_MODE);
+
+  wakeFlags.clear(WAKE_FLAG);
+  int1.rise(&int1_cb);
+  // Latched INT1 may already be high if motion started during configuration
+  if (int1.read() == 0) {
+    // Nothing else holds a deep sleep lock here, so the idle thread puts the
+    // MCU in stop mode until the EXTI line fires
+    wakeFlags.wait_any(WAKE_FLAG);
+  }
+  int1.rise(nullptr);
+
+  // Stop mode turns off PLLSAI, which clocks the LTDC
+  __HAL_RCC_PLLSAI_ENABLE();
+  while (!__HAL_RCC_PLLSAI_GET_FLAG()) {
+  }
+  sdramCommand(FMC_SDRAM_CMD_NORMAL_MODE);
+  BSP_LCD_DisplayOn();
+
+  restoreFullRate(spi);
+
+  if (DEBUG) {
+    printf("wake\n");
+  }
+}
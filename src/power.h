@@ -0,0 +1,16 @@
+#ifndef __POWER_H
+#define __POWER_H
+
+#include "mbed.h"
+
+// Track how long the wearer has been still; returns true once the board
+// should enter the idle mode
+bool updateIdleState(float gx, float gy, float gz);
+
+// Put the gyro in its low-rate wake-on-motion mode, turn the display off and
+// deep sleep until INT1 fires, then restore full-rate acquisition. The gyro
+// is programmed through spi, the acquisition loop's, with no transfer
+// running
+void sleepUntilMotion(SPI &spi);
+
+#endif
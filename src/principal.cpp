@@ -0,0 +1,49 @@
+#include "principal.h"
+
+#include <cmath>
+
+#include "config.h"
+
+static float mean[3];
+// Running covariance: xx, yy, zz, xy, xz, yz
+static float cov[6];
+// Dominant eigenvector, refined by one power iteration step per sample
+static float v[3] = {0.57735027f, 0.57735027f, 0.57735027f};
+
+float updatePrincipalAxis(float gx, float gy, float gz, float dt) {
+  float alpha = dt * (1.0f / PRINCIPAL_TIME_CONSTANT);
+
+  mean[0] += alpha * (gx - mean[0]);
+  mean[1] += alpha * (gy - mean[1]);
+  mean[2] += alpha * (gz - mean[2]);
+  float ex = gx - mean[0], ey = gy - mean[1], ez = gz - mean[2];
+
+  cov[0] += alpha * (ex * ex - cov[0]);
+  cov[1] += alpha * (ey * ey - cov[1]);
+  cov[2] += alpha * (ez * ez - cov[2]);
+  cov[3] += alpha * (ex * ey - cov[3]);
+  cov[4] += alpha * (ex * ez - cov[4]);
+  cov[5] += alpha * (ey * ez - cov[5]);
+
+  // Covariance is positive semi-definite, so C v never flips the sign of v
+  // and the projection keeps a stable polarity
+  float wx = cov[0] * v[0] + cov[3] * v[1] + cov[4] * v[2];
+  float wy = cov[3] * v[0] + cov[1] * v[1] + cov[5] * v[2];
+  float wz = cov[4] * v[0] + cov[5] * v[1] + cov[2] * v[2];
+  float norm = wx * wx + wy * wy + wz * wz;
+  // Keep the previous axis while there is no motion to learn from
+  if (norm > PRINCIPAL_MIN_ENERGY) {
+    float inv = 1.0f / sqrtf(norm);
+    v[0] = wx * inv;
+    v[1] = wy * inv;
+    v[2] = wz * inv;
+  }
+
+  return gx * v[0] + gy * v[1] + gz * v[2];
+}
+
+void principalAxis(float axis[3]) {
+  axis[0] = v[0];
+  axis[1] = v[1];
+  axis[2] = v[2];
+}
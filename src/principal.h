@@ -0,0 +1,12 @@
+#ifndef __PRINCIPAL_H
+#define __PRINCIPAL_H
+
+// Feed one gyro sample (rad/s) taken dt seconds after the previous one and
+// return the angular rate about the principal axis of rotation, i.e. the
+// leg's swing axis whatever the board's orientation
+float updatePrincipalAxis(float gx, float gy, float gz, float dt);
+
+// Current unit estimate of the swing axis in sensor coordinates
+void principalAxis(float axis[3]);
+
+#endif
@@ -0,0 +1,184 @@
+#ifndef __ROBUST_H
+#define __ROBUST_H
+
+// Order statistics over the last N samples of a stream, without scanning the
+// window. Both keep everything in fixed arrays.
+//
+//   SlidingMinMax<9> range;  // O(1) amortised per sample
+//   RunningMedian<9> median;  // O(log N) per sample
+//   range.push(x);
+//   median.push(x);
+//   float spread = range.max() - range.min();
+//   float m = median.median();
+
+// Monotonic deques of (value, sample number): the front of each is the
+// extreme of the window, and a new sample drops every entry it dominates
+template <int N>
+class SlidingMinMax {
+ public:
+  void push(float x) {
+    count_++;
+    pushBack(min_, x, false);
+    pushBack(max_, x, true);
+  }
+
+  bool full() const { return count_ >= N; }
+  float min() const { return min_.values[min_.head]; }
+  float max() const { return max_.values[max_.head]; }
+
+ private:
+  struct Deque {
+    float values[N];
+    unsigned stamps[N];
+    int head = 0;
+    int size = 0;
+  };
+
+  void pushBack(Deque &d, float x, bool keepLarger) {
+    // Drop the sample leaving the window
+    if (d.size > 0 && count_ - d.stamps[d.head] >= (unsigned)N) {
+      d.head = (d.head + 1) % N;
+      d.size--;
+    }
+    // Drop the entries x dominates from the back
+    while (d.size > 0) {
+      float back = d.values[(d.head + d.size - 1) % N];
+      if (keepLarger ? back > x : back < x) {
+        break;
+      }
+      d.size--;
+    }
+    int tail = (d.head + d.size) % N;
+    d.values[tail] = x;
+    d.stamps[tail] = count_;
+    d.size++;
+  }
+
+  unsigned count_ = 0;
+  Deque min_, max_;
+};
+
+// Two indexed heaps over the window slots: a max-heap of the lower half and
+// a min-heap of the upper half. Once the window is full a new sample takes
+// the slot of the oldest in place, so only one heap entry moves
+template <int N>
+class RunningMedian {
+ public:
+  void push(float x) {
+    int slot = head_;
+    head_ = (head_ + 1) % N;
+    values_[slot] = x;
+
+    if (count_ < N) {
+      count_++;
+      if (lowSize_ == 0 || x <= values_[low_[0]]) {
+        insert(low_, lowSize_, true, slot);
+      } else {
+        insert(high_, highSize_, false, slot);
+      }
+      // Keep the lower half the same size or one larger
+      if (lowSize_ > highSize_ + 1) {
+        insert(high_, highSize_, false, popTop(low_, lowSize_, true));
+      } else if (highSize_ > lowSize_) {
+        insert(low_, lowSize_, true, popTop(high_, highSize_, false));
+      }
+    } else if (inLow_[slot]) {
+      restore(low_, lowSize_, true, where_[slot]);
+    } else {
+      restore(high_, highSize_, false, where_[slot]);
+    }
+
+    // A changed value may now belong to the other half
+    if (highSize_ > 0 && values_[low_[0]] > values_[high_[0]]) {
+      int a = low_[0], b = high_[0];
+      place(low_, true, 0, b);
+      place(high_, false, 0, a);
+      siftDown(low_, lowSize_, true, 0);
+      siftDown(high_, highSize_, false, 0);
+    }
+  }
+
+  bool full() const { return count_ >= N; }
+
+  float median() const {
+    if (lowSize_ > highSize_) {
+      return values_[low_[0]];
+    }
+    return 0.5f * (values_[low_[0]] + values_[high_[0]]);
+  }
+
+ private:
+  // Whether slot a belongs above slot b in the given heap
+  bool above(bool maxHeap, int a, int b) const {
+    return maxHeap ? values_[a] > values_[b] : values_[a] < values_[b];
+  }
+
+  void place(int *heap, bool maxHeap, int i, int slot) {
+    heap[i] = slot;
+    where_[slot] = i;
+    inLow_[slot] = maxHeap;
+  }
+
+  void siftUp(int *heap, bool maxHeap, int i) {
+    while (i > 0) {
+      int parent = (i - 1) / 2;
+      if (!above(maxHeap, heap[i], heap[parent])) {
+        break;
+      }
+      int slot = heap[parent];
+      place(heap, maxHeap, parent, heap[i]);
+      place(heap, maxHeap, i, slot);
+      i = parent;
+    }
+  }
+
+  void siftDown(int *heap, int size, bool maxHeap, int i) {
+    while (true) {
+      int best = i;
+      for (int child = 2 * i + 1; child <= 2 * i + 2 && child < size;
+           ++child) {
+        if (above(maxHeap, heap[child], heap[best])) {
+          best = child;
+        }
+      }
+      if (best == i) {
+        return;
+      }
+      int slot = heap[best];
+      place(heap, maxHeap, best, heap[i]);
+      place(heap, maxHeap, i, slot);
+      i = best;
+    }
+  }
+
+  // Re-seat entry i after its value changed
+  void restore(int *heap, int size, bool maxHeap, int i) {
+    int slot = heap[i];
+    siftUp(heap, maxHeap, i);
+    siftDown(heap, size, maxHeap, where_[slot]);
+  }
+
+  void insert(int *heap, int &size, bool maxHeap, int slot) {
+    place(heap, maxHeap, size, slot);
+    siftUp(heap, maxHeap, size++);
+  }
+
+  int popTop(int *heap, int &size, bool maxHeap) {
+    int top = heap[0];
+    place(heap, maxHeap, 0, heap[--size]);
+    siftDown(heap, size, maxHeap, 0);
+    return top;
+  }
+
+  float values_[N];
+  int low_[(N + 1) / 2 + 1];
+  int high_[N / 2 + 1];
+  int where_[N];
+  bool inLow_[N];
+  int lowSize_ = 0;
+  int highSize_ = 0;
+  int head_ = 0;
+  int count_ = 0;
+};
+
+#endif
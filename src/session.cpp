@@ -0,0 +1,76 @@
+#include "session.h"
+
+#include "config.h"
+#include "kahan.h"
+
+static KahanSum distance;
+static uint64_t startUs = 0;
+static uint64_t lastUs = 0;
+static bool started = false;
+static uint32_t steps = 0;
+
+// Minute roll-ups, oldest overwritten first
+static MinuteSummary history[SESSION_HISTORY_MINUTES];
+static int historyHead = 0;
+static int historyCount = 0;
+static uint64_t minuteEndUs = 0;
+static float minuteStartDistance = 0.0f;
+static uint32_t minuteStartSteps = 0;
+
+static void closeMinute() {
+  float cm = (distance.sum - minuteStartDistance) * 100.0f;
+  uint32_t minuteSteps = 2 * (steps - minuteStartSteps);
+  history[historyHead].distanceCm = (uint16_t)(cm > 65535.0f ? 65535 : cm);
+  history[historyHead].steps =
+      (uint16_t)(minuteSteps > 65535 ? 65535 : minuteSteps);
+  historyHead = (historyHead + 1) % SESSION_HISTORY_MINUTES;
+  if (historyCount < SESSION_HISTORY_MINUTES) {
+    historyCount++;
+  }
+  minuteStartDistance = distance.sum;
+  minuteStartSteps = steps;
+  minuteEndUs += 60000000ULL;
+}
+
+void updateSession(float distanceDelta, uint64_t timestampUs, bool stride) {
+  if (!started) {
+    started = true;
+    startUs = timestampUs;
+    minuteEndUs = timestampUs + 60000000ULL;
+  }
+  lastUs = timestampUs;
+  distance.add(distanceDelta);
+  if (stride) {
+    steps++;
+  }
+  while (timestampUs >= minuteEndUs) {
+    closeMinute();
+  }
+}
+
+void resetSession() {
+  distance.reset();
+  started = false;
+  startUs = 0;
+  lastUs = 0;
+  steps = 0;
+  historyHead = 0;
+  historyCount = 0;
+  minuteStartDistance = 0.0f;
+  minuteStartSteps = 0;
+}
+
+float sessionDistance() { return distance.sum; }
+
+// Derived from the integer timestamps, so it does not drift either
+float sessionTime() { return (float)(lastUs - startUs) * 1e-6f; }
+
+uint32_t sessionSteps() { return 2 * steps; }
+
+int sessionMinutes() { return historyCount; }
+
+MinuteSummary sessionMinute(int ago) {
+  int index = (historyHead - 1 - ago + 2 * SESSION_HISTORY_MINUTES) %
+              SESSION_HISTORY_MINUTES;
+  return history[index];
+}
@@ -0,0 +1,29 @@
+#ifndef __SESSION_H
+#define __SESSION_H
+
+#include <stdint.h>
+
+// Totals for one minute of the session
+struct MinuteSummary {
+  uint16_t distanceCm;
+  uint16_t steps;
+};
+
+// Feed the distance (m) covered by the latest sample, its timestamp and
+// whether it completed a stride
+void updateSession(float distance, uint64_t timestampUs, bool stride);
+
+// Start over: totals and minute history back to zero; the next sample
+// starts the clock
+void resetSession();
+
+// Running totals since the session started
+float sessionDistance();
+float sessionTime();
+uint32_t sessionSteps();
+
+// Completed minutes kept in the history, and one of them (0 = latest)
+int sessionMinutes();
+MinuteSummary sessionMinute(int ago);
+
+#endif
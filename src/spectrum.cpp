@@ -0,0 +1,212 @@
+#include "spectrum.h"
+
+#include <cmath>
+
+#include "config.h"
+#include "decimator.h"
+
+// CMSIS-DSP only when asked for with SPECTRUM_CMSIS, the portable FFT below
+// otherwise
+#if SPECTRUM_CMSIS
+#if defined(__has_include)
+#if !__has_include("arm_math.h")
+#error "SPECTRUM_CMSIS needs CMSIS-DSP (arm_math.h) on the include path"
+#endif
+#endif
+#include "arm_math.h"
+static arm_rfft_fast_instance_f32 rfftInstance;
+#endif
+
+#define PI_F 3.14159265358979f
+#define HALF (SPECTRUM_SIZE / 2)
+
+static_assert((SPECTRUM_SIZE & (SPECTRUM_SIZE - 1)) == 0,
+              "SPECTRUM_SIZE must be a power of two");
+
+// All buffers are static: nothing is allocated per block
+static float window[SPECTRUM_SIZE];
+// e^(-2 pi i k / SPECTRUM_SIZE) for k < SPECTRUM_SIZE / 2, as cos, sin pairs
+static float twiddle[SPECTRUM_SIZE];
+static float history[SPECTRUM_SIZE];
+static float work[SPECTRUM_SIZE];
+static float output[SPECTRUM_SIZE];
+
+static int historyHead = 0;
+static int hopCount = 0;
+static int filled = 0;
+static Decimator<SPECTRUM_RATE> decimator;
+
+static float frequency = 0.0f;
+static float bandEnergy = 0.0f;
+
+void initSpectrum() {
+  for (int i = 0; i < SPECTRUM_SIZE; ++i) {
+    window[i] = 0.5f - 0.5f * cosf(2.0f * PI_F * i / SPECTRUM_SIZE);
+  }
+  for (int k = 0; k < HALF; ++k) {
+    twiddle[2 * k] = cosf(2.0f * PI_F * k / SPECTRUM_SIZE);
+    twiddle[2 * k + 1] = -sinf(2.0f * PI_F * k / SPECTRUM_SIZE);
+  }
+#if SPECTRUM_CMSIS
+  arm_rfft_fast_init_f32(&rfftInstance, SPECTRUM_SIZE);
+#endif
+}
+
+// In-place radix-2 FFT of HALF complex values stored as re, im pairs
+static void complexFft(float *data) {
+  for (int i = 1, j = 0; i < HALF; ++i) {
+    int bit = HALF >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j |= bit;
+    if (i < j) {
+      float re = data[2 * i], im = data[2 * i + 1];
+      data[2 * i] = data[2 * j];
+      data[2 * i + 1] = data[2 * j + 1];
+      data[2 * j] = re;
+      data[2 * j + 1] = im;
+    }
+  }
+  for (int length = 2; length <= HALF; length <<= 1) {
+    // Twiddles of a HALF-point FFT are every other entry of the table
+    int stride = 2 * (HALF / length);
+    for (int start = 0; start < HALF; start += length) {
+      for (int k = 0; k < length / 2; ++k) {
+        float wr = twiddle[2 * k * stride], wi = twiddle[2 * k * stride + 1];
+        float *a = data + 2 * (start + k);
+        float *b = data + 2 * (start + k + length / 2);
+        float tr = b[0] * wr - b[1] * wi;
+        float ti = b[0] * wi + b[1] * wr;
+        b[0] = a[0] - tr;
+        b[1] = a[1] - ti;
+        a[0] += tr;
+        a[1] += ti;
+      }
+    }
+  }
+}
+
+// Portable real FFT with the same packed output as arm_rfft_fast_f32:
+// out[0] = X[0], out[1] = X[N/2], then re, im of X[1] .. X[N/2 - 1].
+// Destroys in
+static void portableRfft(float *in, float *out) {
+  // Treat even/odd samples as one complex sequence of half the length
+  complexFft(in);
+  out[0] = in[0] + in[1];
+  out[1] = in[0] - in[1];
+  for (int k = 1; k < HALF; ++k) {
+    float ar = in[2 * k], ai = in[2 * k + 1];
+    float br = in[2 * (HALF - k)], bi = -in[2 * (HALF - k) + 1];
+    // Even part (a + conj b) / 2 and odd part (a - conj b) / 2i
+    float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);
+    float dr = 0.5f * (ai - bi), di = -0.5f * (ar - br);
+    float wr = twiddle[2 * k], wi = twiddle[2 * k + 1];
+    out[2 * k] = er + dr * wr - di * wi;
+    out[2 * k + 1] = ei + dr * wi + di * wr;
+  }
+}
+
+void spectrumRfft(float *in, float *out) {
+#if SPECTRUM_CMSIS
+  arm_rfft_fast_f32(&rfftInstance, in, out, 0);
+#else
+  portableRfft(in, out);
+#endif
+}
+
+static void analyse() {
+  // Unroll the ring, oldest sample first, applying the window
+  for (int i = 0; i < SPECTRUM_SIZE; ++i) {
+    work[i] = history[(historyHead + i) % SPECTRUM_SIZE] * window[i];
+  }
+  spectrumRfft(work, output);
+
+  const float binHz = (float)SPECTRUM_RATE / SPECTRUM_SIZE;
+  int low = (int)(SPECTRUM_BAND_LOW / binHz);
+  int high = (int)(SPECTRUM_BAND_HIGH / binHz);
+  if (high > HALF - 2) {
+    high = HALF - 2;
+  }
+
+  // Power per bin; bin 0 (the mean) is left out of the total
+  float total = 0.0f, band = 0.0f, peak = 0.0f;
+  int peakBin = low;
+  for (int k = 1; k < HALF; ++k) {
+    float power = output[2 * k] * output[2 * k] +
+                  output[2 * k + 1] * output[2 * k + 1];
+    work[k] = power;
+    total += power;
+    if (k >= low && k <= high) {
+      band += power;
+      if (power > peak) {
+        peak = power;
+        peakBin = k;
+      }
+    }
+  }
+  bandEnergy = total > 0.0f ? band / total : 0.0f;
+
+  // Parabolic interpolation between the neighbouring bins
+  float offset = 0.0f;
+  if (peakBin > 1) {
+    float a = work[peakBin - 1], b = work[peakBin], c = work[peakBin + 1];
+    float denominator = a - 2.0f * b + c;
+    if (denominator != 0.0f) {
+      offset = 0.5f * (a - c) / denominator;
+    }
+  }
+  frequency = (peakBin + offset) * binHz;
+}
+
+bool updateSpectrum(float rate, uint64_t timestampUs) {
+  // Average down to SPECTRUM_RATE, whatever the gyro's rate
+  if (!decimator.update(rate, timestampUs, &history[historyHead])) {
+    return false;
+  }
+  historyHead = (historyHead + 1) % SPECTRUM_SIZE;
+
+  if (filled < SPECTRUM_SIZE) {
+    filled++;
+  }
+  if (++hopCount < SPECTRUM_HOP || filled < SPECTRUM_SIZE) {
+    return false;
+  }
+  hopCount = 0;
+  analyse();
+  return true;
+}
+
+float spectrumFrequency() { return frequency; }
+
+// The swing axis oscillates once per stride, i.e. every two steps
+float spectrumCadence() { return 120.0f * frequency; }
+
+float spectrumBandEnergy() { return bandEnergy; }
+
+float spectrumSelfTest() {
+#if SPECTRUM_CMSIS
+  static float reference[SPECTRUM_SIZE];
+  for (int i = 0; i < SPECTRUM_SIZE; ++i) {
+    work[i] = sinf(2.0f * PI_F * 5.0f * i / SPECTRUM_SIZE) +
+              0.25f * cosf(2.0f * PI_F * 17.0f * i / SPECTRUM_SIZE) +
+              0.1f * (float)(i % 7);
+    history[i] = work[i];
+  }
+  arm_rfft_fast_f32(&rfftInstance, work, output, 0);
+  portableRfft(history, reference);
+  // Start over with a clean history
+  for (int i = 0; i < SPECTRUM_SIZE; ++i) {
+    history[i] = 0.0f;
+  }
+  filled = 0;
+
+  float worst = 0.0f;
+  for (int i = 0; i < SPECTRUM_SIZE; ++i) {
+    worst = fmaxf(worst, fabsf(output[i] - reference[i]));
+  }
+  return worst;
+#else
+  return -1.0f;  // only one backend built in
+#endif
+}
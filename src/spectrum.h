@@ -0,0 +1,31 @@
+#ifndef __SPECTRUM_H
+#define __SPECTRUM_H
+
+#include <stdint.h>
+
+// Build the window and FFT tables; call once before updateSpectrum
+void initSpectrum();
+
+// Feed one angular rate sample (rad/s) about the swing axis. It is averaged
+// down to SPECTRUM_RATE; every SPECTRUM_HOP decimated samples a Hann
+// windowed real FFT of the last SPECTRUM_SIZE is taken. Returns true when a
+// new spectrum is ready
+bool updateSpectrum(float rate, uint64_t timestampUs);
+
+// Dominant frequency (Hz) in the gait band of the latest spectrum, the
+// matching cadence (steps per minute) and the band's share of the energy
+float spectrumFrequency();
+float spectrumCadence();
+float spectrumBandEnergy();
+
+// Real FFT of SPECTRUM_SIZE samples with the backend built in, packed as
+// arm_rfft_fast_f32 packs it: out[0] = X[0], out[1] = X[N/2], then re, im
+// of X[1] .. X[N/2 - 1]. Destroys in
+void spectrumRfft(float *in, float *out);
+
+// Run the CMSIS-DSP and portable FFTs on the same test signal and return
+// the largest difference between their outputs; negative when not run,
+// without SPECTRUM_CMSIS
+float spectrumSelfTest();
+
+#endif
@@ -0,0 +1,89 @@
+#include "stepdetect.h"
+
+#include "config.h"
+
+// Sign that makes the swing peak positive; learned from the strides
+static float polarity = 1.0f;
+
+static bool inPeak = false;
+static float peak = 0.0f;
+static uint64_t peakUs = 0;  // when the rate reached peak
+static float trough = 0.0f;
+static float peakLevel = STEP_MIN_THRESHOLD / STEP_THRESHOLD_RATIO;
+
+static uint64_t lastStepUs = 0;
+static uint32_t steps = 0;
+static float cadence = 0.0f;
+
+bool updateStepDetector(float rate, uint64_t timestampUs, StepEvent *event) {
+  float s = polarity * rate;
+
+  // Forget the previous gait after a pause so slower walking is picked up
+  if (timestampUs - lastStepUs > STEP_TIMEOUT_US) {
+    peakLevel = STEP_MIN_THRESHOLD / STEP_THRESHOLD_RATIO;
+    cadence = 0.0f;
+  }
+
+  float high = STEP_THRESHOLD_RATIO * peakLevel;
+  if (high < STEP_MIN_THRESHOLD) {
+    high = STEP_MIN_THRESHOLD;
+  }
+
+  if (!inPeak) {
+    if (s < trough) {
+      trough = s;
+    }
+    if (s > high) {
+      inPeak = true;
+      peak = s;
+      peakUs = timestampUs;
+    }
+    return false;
+  }
+
+  if (s > peak) {
+    peak = s;
+    peakUs = timestampUs;
+  }
+  // Hysteresis: the peak ends only once the rate falls well below threshold
+  if (s > STEP_HYSTERESIS * high) {
+    return false;
+  }
+  inPeak = false;
+
+  // Stronger excursions on the other side mean the board is mounted the
+  // other way round: flip and start over
+  if (-trough > STEP_POLARITY_RATIO * peak) {
+    polarity = -polarity;
+    trough = 0.0f;
+    return false;
+  }
+
+  // Strides are timed from peak to peak: the end of the hysteresis depends
+  // on how slowly the swing winds down
+  uint64_t interval = peakUs - lastStepUs;
+  float amplitude = peak - trough;
+  trough = s;
+  if (interval < STEP_MIN_INTERVAL_US) {
+    return false;
+  }
+
+  peakLevel += STEP_ADAPT_RATE * (peak - peakLevel);
+  if (interval < STEP_TIMEOUT_US) {
+    float strideCadence = 2.0f * 60.0e6f / (float)interval;
+    cadence = (cadence == 0.0f)
+                  ? strideCadence
+                  : cadence + STEP_ADAPT_RATE * (strideCadence - cadence);
+  }
+  lastStepUs = peakUs;
+  steps++;
+
+  event->timestampUs = peakUs;
+  event->cadence = cadence;
+  event->amplitude = amplitude;
+  return true;
+}
+
+uint32_t strideCount() { return steps; }
+
+float stepCadence() { return cadence; }
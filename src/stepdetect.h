@@ -0,0 +1,22 @@
+#ifndef __STEPDETECT_H
+#define __STEPDETECT_H
+
+#include <stdint.h>
+
+// One stride of the leg wearing the board
+struct StepEvent {
+  uint64_t timestampUs;  // time of the swing peak's maximum
+  float cadence;         // steps per minute (two steps per stride)
+  float amplitude;       // peak-to-trough angular rate of the stride, rad/s
+};
+
+// Feed one angular rate sample (rad/s) about the swing axis. Returns true
+// and fills event when a swing peak completes a stride, a few samples after
+// its maximum, once the rate has fallen through the hysteresis
+bool updateStepDetector(float rate, uint64_t timestampUs, StepEvent *event);
+
+// Strides detected so far and the smoothed cadence (steps per minute)
+uint32_t strideCount();
+float stepCadence();
+
+#endif
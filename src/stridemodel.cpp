@@ -0,0 +1,126 @@
+#include "stridemodel.h"
+
+#include <cmath>
+
+#include "config.h"
+#include "mbed.h"
+#include "orientation.h"
+#include "persist.h"
+
+static float legLength = 0.0f;
+
+// length = scale * sin(angle / 2) + slope * cadence + offset
+static float scale;
+static float slope;
+static float offset;
+
+static bool active = false;
+static int walkStrides = 0;
+static float walkFeatures[3];
+
+// Features of one stride, all in metres so the coefficients are unitless
+// except the offset: pendulum stride, cadence term, and 1 for the offset
+static void features(float swingAngle, float cadence, float out[3]) {
+  out[0] = strideLength(swingAngle, legLength);
+  out[1] = legLength * cadence / STRIDE_REFERENCE_CADENCE;
+  out[2] = 1.0f;
+}
+
+static void precompute() {
+  const float *c = persistent.strideCoefficients;
+  scale = 4.0f * legLength * c[0];
+  slope = legLength * c[1] / STRIDE_REFERENCE_CADENCE;
+  offset = c[2];
+}
+
+// Prior: the plain pendulum model, loosely held
+static void resetFit() {
+  for (int i = 0; i < 3; ++i) {
+    persistent.strideCoefficients[i] = (i == 0) ? 1.0f : 0.0f;
+    for (int j = 0; j < 3; ++j) {
+      persistent.strideCovariance[i][j] = (i == j) ? STRIDE_PRIOR_VARIANCE : 0;
+    }
+  }
+  persistent.strideCovariance[2][2] = STRIDE_PRIOR_OFFSET_VARIANCE;
+}
+
+void initStrideModel(int height) {
+  // Assume leg length is 45% of height and convert to meters
+  legLength = (height * 0.45f) / 100;
+  if (persistent.strideWalks == 0) {
+    resetFit();
+  }
+  precompute();
+}
+
+float strideLegLength() { return legLength; }
+
+float strideModelLength(float swingAngle, float cadence) {
+  float length = scale * sinf(0.5f * swingAngle) + slope * cadence + offset;
+  return length > 0.0f ? length : 0.0f;
+}
+
+void startCalibration() {
+  active = true;
+  walkStrides = 0;
+  walkFeatures[0] = walkFeatures[1] = walkFeatures[2] = 0.0f;
+}
+
+void calibrationStride(float swingAngle, float cadence) {
+  if (!active) {
+    return;
+  }
+  // Only the sum over the walk is fitted, so keep just that
+  float f[3];
+  features(swingAngle, cadence, f);
+  for (int i = 0; i < 3; ++i) {
+    walkFeatures[i] += f[i];
+  }
+  walkStrides++;
+}
+
+// One recursive least squares step: the walk is a single observation
+// r . coefficients = distance
+static void foldWalk(const float r[3], float distance) {
+  float(*p)[3] = persistent.strideCovariance;
+  float *c = persistent.strideCoefficients;
+
+  float pr[3];
+  float variance = STRIDE_DISTANCE_VARIANCE;
+  float error = distance;
+  for (int i = 0; i < 3; ++i) {
+    pr[i] = p[i][0] * r[0] + p[i][1] * r[1] + p[i][2] * r[2];
+    variance += r[i] * pr[i];
+    error -= r[i] * c[i];
+  }
+  for (int i = 0; i < 3; ++i) {
+    c[i] += pr[i] * error / variance;
+    for (int j = 0; j < 3; ++j) {
+      p[i][j] -= pr[i] * pr[j] / variance;
+    }
+  }
+}
+
+bool finishCalibration(float distance) {
+  active = false;
+  if (walkStrides < STRIDE_MIN_CALIBRATION_STRIDES) {
+    return false;
+  }
+  foldWalk(walkFeatures, distance);
+  if (persistent.strideWalks < 255) {
+    persistent.strideWalks++;
+  }
+  precompute();
+  if (DEBUG) {
+    printf("stride model: %f %f %f after %d strides\n",
+           persistent.strideCoefficients[0], persistent.strideCoefficients[1],
+           persistent.strideCoefficients[2], walkStrides);
+  }
+  return savePersistentData();
+}
+
+bool calibrating() { return active; }
+
+int calibrationStrides() { return walkStrides; }
+
+int calibrationWalks() { return persistent.strideWalks; }
@@ -0,0 +1,32 @@
+#ifndef __STRIDEMODEL_H
+#define __STRIDEMODEL_H
+
+// Stride length as a linear model of the pendulum stride, the cadence and a
+// constant, with coefficients fitted per user on calibration walks
+
+// Precompute the per-stride coefficients for a user of the given height (cm).
+// Uses the stored fit if there is one; call after the settings are loaded
+void initStrideModel(int height);
+
+// Leg length (m) assumed for the user's height
+float strideLegLength();
+
+// Length (m) of a stride with the given swing angle (rad) and cadence
+// (steps per minute)
+float strideModelLength(float swingAngle, float cadence);
+
+// Calibration walk: start it, feed every stride, then finish it with the
+// distance (m) actually walked. finishCalibration folds the walk into the
+// fit and saves it; it returns false if the walk had too few strides
+void startCalibration();
+void calibrationStride(float swingAngle, float cadence);
+bool finishCalibration(float distance);
+
+// Whether a calibration walk is in progress, and its strides so far
+bool calibrating();
+int calibrationStrides();
+
+// Calibration walks folded into the stored fit
+int calibrationWalks();
+
+#endif
@@ -0,0 +1,116 @@
+#include "tempcomp.h"
+
+#include "mbed.h"
+#include "odr.h"
+#include "persist.h"
+
+static int sampleCount = 0;
+static int bin = -1;
+static int16_t bias[3];
+
+static int blockCount = 0;
+static int32_t blockSum[3];
+static int64_t blockSumSquared[3];
+
+static bool dirty = false;
+static bool saved = false;
+static uint64_t lastSaveUs = 0;
+
+void initTempComp() { loadPersistentData(); }
+
+bool temperatureDue() { return sampleCount == 0; }
+
+// Cache the bias of the nearest bin that has learned anything
+static void selectBias() {
+  for (int offset = 0; offset < TEMP_BINS; ++offset) {
+    int candidates[2] = {bin - offset, bin + offset};
+    for (int c : candidates) {
+      if (c >= 0 && c < TEMP_BINS && persistent.tempBiasBlocks[c] > 0) {
+        for (int i = 0; i < 3; ++i) {
+          bias[i] = (int16_t)lroundf(persistent.tempBias[c][i]);
+        }
+        return;
+      }
+    }
+  }
+  bias[0] = bias[1] = bias[2] = 0;
+}
+
+void updateTemperature(int8_t outTemp) {
+  // OUT_TEMP is -1 LSB/degC with an unknown offset, so bin the raw value
+  int newBin = ((int)outTemp + 128) >> TEMP_BIN_SHIFT;
+  if (newBin != bin) {
+    bin = newBin;
+    selectBias();
+    if (DEBUG) {
+      printf("temp bin %d: %d %d %d\n", bin, bias[0], bias[1], bias[2]);
+    }
+  }
+}
+
+// Fold a still block's mean into the table
+static void learnBlock() {
+  const int64_t n = TEMP_LEARN_SAMPLES;
+  for (int i = 0; i < 3; ++i) {
+    // n^2 * variance = n * sum(x^2) - sum(x)^2
+    int64_t spread =
+        n * blockSumSquared[i] - (int64_t)blockSum[i] * blockSum[i];
+    if (spread > (int64_t)TEMP_STILL_VARIANCE * n * n) {
+      return;
+    }
+  }
+  uint8_t &blocks = persistent.tempBiasBlocks[bin];
+  if (blocks < TEMP_LEARN_MAX_BLOCKS) {
+    blocks++;
+  }
+  for (int i = 0; i < 3; ++i) {
+    float mean = (float)blockSum[i] / n;
+    persistent.tempBias[bin][i] +=
+        (mean - persistent.tempBias[bin][i]) / blocks;
+  }
+  dirty = true;
+  selectBias();
+}
+
+static int16_t saturate(int32_t value) {
+  return (int16_t)(value > 32767 ? 32767 : value < -32768 ? -32768 : value);
+}
+
+void compensateBias(int16_t *gx, int16_t *gy, int16_t *gz) {
+  int16_t *axes[3] = {gx, gy, gz};
+
+  sampleCount = (sampleCount + 1) % TEMP_READ_SAMPLES;
+
+  for (int i = 0; i < 3; ++i) {
+    int32_t raw = *axes[i];
+    blockSum[i] += raw;
+    blockSumSquared[i] += raw * raw;
+    *axes[i] = saturate(raw - bias[i]);
+  }
+
+  if (++blockCount == TEMP_LEARN_SAMPLES) {
+    if (bin >= 0) {
+      learnBlock();
+    }
+    blockCount = 0;
+    for (int i = 0; i < 3; ++i) {
+      blockSum[i] = 0;
+      blockSumSquared[i] = 0;
+    }
+  }
+}
+
+void saveTempComp() {
+  // Limit flash wear: after the first save, which keeps what was learned
+  // since power-up, at most one erase per TEMP_SAVE_INTERVAL_S of samples
+  uint64_t now = odrTimestampUs();
+  if (!dirty ||
+      (saved && now - lastSaveUs < TEMP_SAVE_INTERVAL_S * 1000000ULL)) {
+    return;
+  }
+  if (savePersistentDataInBackground()) {
+    dirty = false;
+    saved = true;
+    lastSaveUs = now;
+  }
+}
@@ -0,0 +1,23 @@
+#ifndef __TEMPCOMP_H
+#define __TEMPCOMP_H
+
+#include <stdint.h>
+
+// Load the learned bias table; call once before acquisition starts
+void initTempComp();
+
+// Whether the next data burst should start at OUT_TEMP
+bool temperatureDue();
+
+// New OUT_TEMP reading: selects the bias for the current temperature
+void updateTemperature(int8_t outTemp);
+
+// Learn from and remove the zero-rate level of one raw sample. Integer
+// subtraction only; the table lookup happens in updateTemperature
+void compensateBias(int16_t *gx, int16_t *gy, int16_t *gz);
+
+// Persist the table if it learned something since the last save. Cheap
+// enough for every sample: the flash write runs on a thread of its own
+void saveTempComp();
+
+#endif
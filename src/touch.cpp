@@ -0,0 +1,188 @@
+#include "touch.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "config.h"
+#include "drivers/stm32f429i_discovery_lcd.h"
+#include "drivers/stm32f429i_discovery_ts.h"
+
+#define WAKE_FLAG 1
+
+// The STMPE811's INT output is wired to PA15; it is active low and held
+// until the interrupt status is cleared
+static InterruptIn touchInt(PA_15, PullUp);
+static EventFlags wake;
+static EventFlags *touchFlags = nullptr;
+static uint32_t touchFlag = 0;
+static Thread touchThread(osPriorityBelowNormal, TOUCH_STACK_SIZE, nullptr,
+                          "touch");
+// When full, the oldest event is dropped
+static CircularBuffer<TouchEvent, TOUCH_QUEUE_SIZE> queue;
+
+// The finger on the screen, if any. Positions are filtered in raw ADC units
+// with 4 fractional bits
+static struct {
+  bool down;
+  bool moved;  // beyond TOUCH_TAP_SLOP of where it landed
+  bool held;   // the long press was reported
+  int32_t rawX, rawY;
+  uint16_t startX, startY;
+  uint16_t x, y;
+  uint16_t postedX, postedY;
+  uint32_t startUs;
+} press;
+
+static void touch_cb() { wake.set(WAKE_FLAG); }
+
+// A line still low after clearing (new points came in meanwhile) has no
+// falling edge left to catch
+static void checkPending() {
+  if (touchInt.read() == 0) {
+    wake.set(WAKE_FLAG);
+  }
+}
+
+static void post(uint8_t type, uint16_t x, uint16_t y) {
+  TouchEvent event = {type, x, y};
+  queue.push(event);
+  touchFlags->set(touchFlag);
+}
+
+// The same linear corrections as BSP_TS_GetState, clamped to the display
+static void toPixels() {
+  int rawX = press.rawX >> 4;
+  int rawY = press.rawY >> 4;
+  int x = ((rawX <= 3000 ? 3870 : 3800) - rawX) / 15;
+  int y = (rawY - 360) / 11;
+  press.x = std::min(std::max(x, 0), (int)BSP_LCD_GetXSize() - 1);
+  press.y = std::min(std::max(y, 0), (int)BSP_LCD_GetYSize() - 1);
+}
+
+static void addPoint(const TS_PointTypeDef &point, uint32_t now) {
+  int32_t rawX = (int32_t)point.X << 4;
+  int32_t rawY = (int32_t)point.Y << 4;
+
+  if (!press.down) {
+    // The filter starts from the first point, not from zero
+    press.down = true;
+    press.moved = false;
+    press.held = false;
+    press.rawX = rawX;
+    press.rawY = rawY;
+    press.startUs = now;
+    toPixels();
+    press.startX = press.postedX = press.x;
+    press.startY = press.postedY = press.y;
+    post(TOUCH_DOWN, press.x, press.y);
+    return;
+  }
+
+  // Exponential moving average, weight 1 / 2^TOUCH_FILTER_SHIFT
+  press.rawX += (rawX - press.rawX) >> TOUCH_FILTER_SHIFT;
+  press.rawY += (rawY - press.rawY) >> TOUCH_FILTER_SHIFT;
+  toPixels();
+  if (abs(press.x - press.startX) > TOUCH_TAP_SLOP ||
+      abs(press.y - press.startY) > TOUCH_TAP_SLOP) {
+    press.moved = true;
+  }
+}
+
+static void checkLongPress(uint32_t now) {
+  if (press.down && !press.moved && !press.held &&
+      now - press.startUs >= TOUCH_LONG_PRESS_MS * 1000u) {
+    press.held = true;
+    post(TOUCH_LONG_PRESS, press.x, press.y);
+  }
+}
+
+static void lift(uint32_t now) {
+  press.down = false;
+  post(TOUCH_UP, press.x, press.y);
+  if (press.held) {
+    return;
+  }
+  if (!press.moved) {
+    post(TOUCH_TAP, press.x, press.y);
+    return;
+  }
+  if (now - press.startUs > TOUCH_SWIPE_MAX_MS * 1000u) {
+    return;  // a slow drag, not a swipe
+  }
+
+  int dx = press.x - press.startX;
+  int dy = press.y - press.startY;
+  if (abs(dx) >= abs(dy) && abs(dx) >= TOUCH_SWIPE_MIN) {
+    post(dx < 0 ? TOUCH_SWIPE_LEFT : TOUCH_SWIPE_RIGHT, press.startX,
+         press.startY);
+  } else if (abs(dy) > abs(dx) && abs(dy) >= TOUCH_SWIPE_MIN) {
+    post(dy < 0 ? TOUCH_SWIPE_UP : TOUCH_SWIPE_DOWN, press.startX,
+         press.startY);
+  }
+}
+
+// Clears the interrupt before reading, so that anything arriving during
+// the burst interrupts again, then drains the FIFO
+static void drain() {
+  TS_PointTypeDef points[TOUCH_BURST_POINTS];
+  uint8_t detected = 0;
+  uint8_t count;
+
+  BSP_TS_ITClear();
+  do {
+    count = BSP_TS_ReadPoints(points, TOUCH_BURST_POINTS, &detected);
+    uint32_t now = us_ticker_read();
+    for (uint8_t i = 0; i < count; i++) {
+      addPoint(points[i], now);
+    }
+  } while (count == TOUCH_BURST_POINTS);
+
+  uint32_t now = us_ticker_read();
+  if (press.down && !detected) {
+    lift(now);
+  } else if (press.down) {
+    checkLongPress(now);
+    if (press.x != press.postedX || press.y != press.postedY) {
+      press.postedX = press.x;
+      press.postedY = press.y;
+      post(TOUCH_MOVE, press.x, press.y);
+    }
+  }
+  checkPending();
+}
+
+static void touchLoop() {
+  for (;;) {
+    // While a still finger may become a long press, wake up for it too
+    if (press.down && !press.moved && !press.held) {
+      uint32_t heldMs = (us_ticker_read() - press.startUs) / 1000;
+      uint32_t leftMs =
+          heldMs < TOUCH_LONG_PRESS_MS ? TOUCH_LONG_PRESS_MS - heldMs : 0;
+      uint32_t got = wake.wait_any_for(WAKE_FLAG, leftMs * 1ms);
+      if ((got & osFlagsError) || !(got & WAKE_FLAG)) {
+        checkLongPress(us_ticker_read());
+        continue;
+      }
+    } else {
+      wake.wait_any(WAKE_FLAG);
+    }
+    drain();
+  }
+}
+
+bool initTouch(EventFlags &flags, uint32_t flag) {
+  touchFlags = &flags;
+  touchFlag = flag;
+  if (BSP_TS_Init(BSP_LCD_GetXSize(), BSP_LCD_GetYSize()) != TS_OK) {
+    return false;
+  }
+  touchInt.fall(&touch_cb);
+  if (BSP_TS_ITConfigThreshold(TOUCH_FIFO_THRESHOLD) != TS_OK) {
+    return false;
+  }
+  touchThread.start(touchLoop);
+  checkPending();
+  return true;
+}
+
+bool nextTouchEvent(TouchEvent *event) { return queue.pop(*event); }
@@ -0,0 +1,39 @@
+#ifndef __TOUCH_H
+#define __TOUCH_H
+
+#include "mbed.h"
+
+// Touch screen input. The STMPE811 interrupts only once its FIFO holds
+// TOUCH_FIFO_THRESHOLD points, or when a finger lands or lifts. A thread of
+// its own then drains the FIFO in one I2C burst, smooths the points and
+// turns them into gestures, so the acquisition thread never waits on I2C:
+// it only takes the finished events off a queue
+
+enum TouchEventType {
+  TOUCH_DOWN,        // a finger landed
+  TOUCH_MOVE,        // it moved; one per burst of points, not per point
+  TOUCH_UP,          // it lifted, after any of the gestures below
+  TOUCH_TAP,         // lifted where it landed, before a long press
+  TOUCH_LONG_PRESS,  // held still for TOUCH_LONG_PRESS_MS
+  // Lifted at the end of a quick stroke of TOUCH_SWIPE_MIN pixels or more
+  TOUCH_SWIPE_LEFT,
+  TOUCH_SWIPE_RIGHT,
+  TOUCH_SWIPE_UP,
+  TOUCH_SWIPE_DOWN,
+};
+
+// In display pixels: where the finger is, or for swipes where it landed
+struct TouchEvent {
+  uint8_t type;
+  uint16_t x, y;
+};
+
+// Start the controller and the touch thread; flag is set in flags whenever
+// events are queued. Returns false when there is no touch controller
+bool initTouch(EventFlags &flags, uint32_t flag);
+
+// Take the oldest queued event; false once there are none. No I2C, cheap
+// enough for any thread
+bool nextTouchEvent(TouchEvent *event);
+
+#endif
@@ -0,0 +1,60 @@
+#include "uischedule.h"
+
+#include "config.h"
+#include "load.h"
+#include "mbed.h"
+
+static DashboardValues latest;
+static bool pending = false;
+static bool urgent = false;
+static float targetRate = UI_FRAME_RATE;
+static int rateStep = 0;
+static uint32_t periodUs = (uint32_t)(1e6f / UI_FRAME_RATE);
+static uint32_t lastFrameUs = 0;
+
+static void updatePeriod() {
+  periodUs = (uint32_t)(1e6f / uiFrameRate());
+}
+
+void publishUi(const DashboardValues &values) {
+  latest = values;
+  pending = true;
+}
+
+void requestUiFrame() { urgent = true; }
+
+void setUiFrameRate(float hz) {
+  targetRate = hz;
+  updatePeriod();
+}
+
+float uiFrameRate() { return targetRate / (float)(1 << rateStep); }
+
+bool serviceUi(LCD_DISCO_F429ZI &lcd) {
+  if (!pending) {
+    return false;
+  }
+  uint32_t now = us_ticker_read();
+  if (!urgent && now - lastFrameUs < periodUs) {
+    return false;
+  }
+  pending = false;
+  if (!urgent && !dashboardChanged(latest)) {
+    return false;  // keep the frame slot for the next real change
+  }
+  urgent = false;
+
+  // Back off one step per frame while loaded, and recover the same way
+  float load = cpuLoad();
+  if (load > UI_LOAD_HIGH && rateStep < UI_RATE_STEPS) {
+    rateStep++;
+    updatePeriod();
+  } else if (load < UI_LOAD_LOW && rateStep > 0) {
+    rateStep--;
+    updatePeriod();
+  }
+
+  drawDashboard(lcd, latest);
+  lastFrameUs = now;
+  return true;
+}
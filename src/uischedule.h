@@ -0,0 +1,27 @@
+#ifndef __UISCHEDULE_H
+#define __UISCHEDULE_H
+
+#include "dashboard.h"
+#include "drivers/LCD_DISCO_F429ZI.h"
+
+// Paces the dashboard: models publish their values whenever they change,
+// and at most one frame per frame period draws the latest of them. Frames
+// whose values would print the same are skipped, and while the CPU load is
+// high the frame rate is halved, down to UI_RATE_STEPS times
+
+// Hand over the latest values; cheap, updates between frames coalesce
+void publishUi(const DashboardValues &values);
+
+// Draw the next published values without waiting for the frame period
+void requestUiFrame();
+
+// Frame rate (Hz) aimed for, before any reduction for load
+void setUiFrameRate(float hz);
+
+// Frame rate (Hz) currently used
+float uiFrameRate();
+
+// Call from the acquisition loop; returns true when a frame was drawn
+bool serviceUi(LCD_DISCO_F429ZI &lcd);
+
+#endif
@@ -0,0 +1,180 @@
+#include "widgets.h"
+
+#include "format.h"
+
+// More than fits across the display in the default font
+#define LINE_CHARS 32
+// Slider knob radius and track thickness, in pixels
+#define SLIDER_KNOB 8
+#define SLIDER_TRACK 4
+
+static int length(const char *text) {
+  int n = 0;
+  while (text[n] != '\0') {
+    n++;
+  }
+  return n;
+}
+
+static void drawLine(LCD_DISCO_F429ZI &lcd, int line, const char *label,
+                     const char *value, const char *valueEnd,
+                     const char *unit) {
+  char text[LINE_CHARS + 1];
+  char *end = text + LINE_CHARS;
+  char *p = formatText(text, end, label);
+  p = formatText(p, end, ": ");
+  while (value < valueEnd && p < end) {
+    *p++ = *value++;
+  }
+  if (*unit != '\0') {
+    p = formatText(p, end, " ");
+    p = formatText(p, end, unit);
+  }
+  *p = '\0';
+  lcd.DisplayStringAt(0, LINE(line), (uint8_t *)text, CENTER_MODE);
+}
+
+void drawValue(LCD_DISCO_F429ZI &lcd, int line, const char *label,
+               float value, int decimals, const char *unit) {
+  char number[FORMAT_MAX_CHARS];
+  char *end = formatFixed(number, value, decimals);
+  drawLine(lcd, line, label, number, end, unit);
+}
+
+void drawInt(LCD_DISCO_F429ZI &lcd, int line, const char *label,
+             int32_t value, const char *unit) {
+  char number[FORMAT_MAX_CHARS];
+  char *end = formatInt(number, value);
+  drawLine(lcd, line, label, number, end, unit);
+}
+
+void drawText(LCD_DISCO_F429ZI &lcd, int line, const char *label,
+              const char *text) {
+  drawLine(lcd, line, label, text, text + length(text), "");
+}
+
+// Characters before the value slot, and the x of the first one
+static int slotColumn(const Field &field) { return length(field.label) + 2; }
+
+static int lineX(LCD_DISCO_F429ZI &lcd, const Field &field) {
+  int width = lcd.GetFont()->Width;
+  int columns = lcd.GetXSize() / width;
+  int chars = slotColumn(field) + field.width;
+  if (*field.unit != '\0') {
+    chars += 1 + length(field.unit);
+  }
+  return chars < columns ? (columns - chars) * width / 2 : 0;
+}
+
+static void fillBack(LCD_DISCO_F429ZI &lcd, int x, int y, int width,
+                     int height) {
+  uint32_t color = lcd.GetTextColor();
+  lcd.SetTextColor(lcd.GetBackColor());
+  lcd.FillRect(x, y, width, height);
+  lcd.SetTextColor(color);
+}
+
+void drawFieldChrome(LCD_DISCO_F429ZI &lcd, const Field &field) {
+  char text[LINE_CHARS + 1];
+  char *end = text + LINE_CHARS;
+  int charWidth = lcd.GetFont()->Width;
+  int x = lineX(lcd, field);
+
+  char *p = formatText(text, end, field.label);
+  p = formatText(p, end, ":");
+  *p = '\0';
+  lcd.DisplayStringAt(x, LINE(field.line), (uint8_t *)text, LEFT_MODE);
+
+  if (*field.unit != '\0') {
+    p = formatText(text, end, field.unit);
+    *p = '\0';
+    x += (slotColumn(field) + field.width + 1) * charWidth;
+    lcd.DisplayStringAt(x, LINE(field.line), (uint8_t *)text, LEFT_MODE);
+  }
+}
+
+void clearField(LCD_DISCO_F429ZI &lcd, const Field &field) {
+  fillBack(lcd, 0, LINE(field.line), lcd.GetXSize(), lcd.GetFont()->Height);
+}
+
+// Draw the n characters at text into the slot
+static void drawSlot(LCD_DISCO_F429ZI &lcd, const Field &field,
+                     const char *text, int n, bool rightAlign) {
+  char slot[LINE_CHARS + 1];
+  int charWidth = lcd.GetFont()->Width;
+  int x = lineX(lcd, field) + slotColumn(field) * charWidth;
+  int y = LINE(field.line);
+
+  if (n > field.width) {
+    n = field.width;
+  }
+  for (int i = 0; i < n; ++i) {
+    slot[i] = text[i];
+  }
+  slot[n] = '\0';
+
+  fillBack(lcd, x, y, field.width * charWidth, lcd.GetFont()->Height);
+  if (rightAlign) {
+    x += (field.width - n) * charWidth;
+  }
+  lcd.DisplayStringAt(x, y, (uint8_t *)slot, LEFT_MODE);
+}
+
+void drawFieldValue(LCD_DISCO_F429ZI &lcd, const Field &field, float value,
+                    int decimals) {
+  char number[FORMAT_MAX_CHARS];
+  char *end = formatFixed(number, value, decimals);
+  drawSlot(lcd, field, number, end - number, true);
+}
+
+void drawFieldInt(LCD_DISCO_F429ZI &lcd, const Field &field, int32_t value) {
+  char number[FORMAT_MAX_CHARS];
+  char *end = formatInt(number, value);
+  drawSlot(lcd, field, number, end - number, true);
+}
+
+void drawFieldText(LCD_DISCO_F429ZI &lcd, const Field &field,
+                   const char *text) {
+  drawSlot(lcd, field, text, length(text), false);
+}
+
+void drawButton(LCD_DISCO_F429ZI &lcd, const Button &button) {
+  sFONT *font = lcd.GetFont();
+  int x = button.x + (button.width - length(button.label) * font->Width) / 2;
+  int y = button.y + (button.height - font->Height) / 2;
+  fillBack(lcd, button.x, button.y, button.width, button.height);
+  lcd.DrawRect(button.x, button.y, button.width - 1, button.height - 1);
+  lcd.DisplayStringAt(x, y, (uint8_t *)button.label, LEFT_MODE);
+}
+
+bool buttonHit(const Button &button, int x, int y) {
+  return x >= button.x && x < button.x + button.width && y >= button.y &&
+         y < button.y + button.height;
+}
+
+void drawSlider(LCD_DISCO_F429ZI &lcd, const Slider &slider, int value) {
+  int knob = slider.x + (value - slider.min) * slider.width /
+                            (slider.max - slider.min);
+  fillBack(lcd, slider.x - SLIDER_KNOB - 1, slider.y - SLIDER_KNOB - 1,
+           slider.width + 2 * SLIDER_KNOB + 3, 2 * SLIDER_KNOB + 3);
+  lcd.FillRect(slider.x, slider.y - SLIDER_TRACK / 2, slider.width,
+               SLIDER_TRACK);
+  lcd.FillCircleAA(knob, slider.y, SLIDER_KNOB);
+}
+
+bool sliderHit(const Slider &slider, int x, int y) {
+  // Twice the knob's size, so a finger does not have to be precise
+  return x >= slider.x - 2 * SLIDER_KNOB &&
+         x <= slider.x + slider.width + 2 * SLIDER_KNOB &&
+         y >= slider.y - 2 * SLIDER_KNOB && y <= slider.y + 2 * SLIDER_KNOB;
+}
+
+int sliderValue(const Slider &slider, int x) {
+  int value = slider.min + ((x - slider.x) * (slider.max - slider.min) +
+                            slider.width / 2) /
+                               slider.width;
+  if (value < slider.min) {
+    return slider.min;
+  }
+  return value > slider.max ? slider.max : value;
+}
@@ -0,0 +1,62 @@
+#ifndef __WIDGETS_H
+#define __WIDGETS_H
+
+#include <stdint.h>
+
+#include "drivers/LCD_DISCO_F429ZI.h"
+
+// "label: value unit" lines, centred on a text line of the display. unit may
+// be empty. Formatting goes through format.h, not printf
+void drawValue(LCD_DISCO_F429ZI &lcd, int line, const char *label,
+               float value, int decimals, const char *unit);
+void drawInt(LCD_DISCO_F429ZI &lcd, int line, const char *label,
+             int32_t value, const char *unit);
+void drawText(LCD_DISCO_F429ZI &lcd, int line, const char *label,
+              const char *text);
+
+// The same line with a fixed slot of width characters for the value, so the
+// label and unit (the chrome) can be drawn apart from the value. Each call
+// draws into the currently selected layer; the slot is cleared to the back
+// colour first
+struct Field {
+  int line;
+  const char *label;
+  const char *unit;
+  int width;
+};
+
+void drawFieldChrome(LCD_DISCO_F429ZI &lcd, const Field &field);
+// Clear the whole line, chrome included
+void clearField(LCD_DISCO_F429ZI &lcd, const Field &field);
+// Numbers are right aligned in the slot, text left aligned; both are cut
+// to the slot width
+void drawFieldValue(LCD_DISCO_F429ZI &lcd, const Field &field, float value,
+                    int decimals);
+void drawFieldInt(LCD_DISCO_F429ZI &lcd, const Field &field, int32_t value);
+void drawFieldText(LCD_DISCO_F429ZI &lcd, const Field &field,
+                   const char *text);
+
+// Touch targets: a framed, centred label, and a horizontal slider whose
+// knob spans min..max across width pixels. Hits are tested in display
+// pixels, as the touch screen reports them
+struct Button {
+  int x, y, width, height;
+  const char *label;
+};
+
+struct Slider {
+  int x, y, width;  // y of the track's centre line
+  int min, max;
+};
+
+void drawButton(LCD_DISCO_F429ZI &lcd, const Button &button);
+bool buttonHit(const Button &button, int x, int y);
+
+// Redraw the track and the knob at value
+void drawSlider(LCD_DISCO_F429ZI &lcd, const Slider &slider, int value);
+// Within the knob's reach of the track
+bool sliderHit(const Slider &slider, int x, int y);
+// Value under x, clamped to the slider's range
+int sliderValue(const Slider &slider, int x);
+
+#endif
@@ -0,0 +1,39 @@
+#include "zupt.h"
+
+#include <cmath>
+
+#include "config.h"
+
+static float window[ZUPT_WINDOW];
+static int head = 0;
+static float energy = 0.0f;
+
+static bool stance = false;
+static float bias = 0.0f;
+
+float updateZupt(float rate, float dt, float legLength) {
+  float corrected = rate - bias;
+  float squared = corrected * corrected;
+
+  // Sliding sum of squares over the last ZUPT_WINDOW samples
+  energy += squared - window[head];
+  window[head] = squared;
+  head = (head + 1) % ZUPT_WINDOW;
+  if (head == 0) {
+    // Re-add from scratch once per window so rounding cannot build up
+    energy = 0.0f;
+    for (int i = 0; i < ZUPT_WINDOW; ++i) {
+      energy += window[i];
+    }
+  }
+
+  stance = energy < ZUPT_THRESHOLD * ZUPT_WINDOW;
+  if (stance) {
+    // Zero velocity update: whatever the gyro reads now is bias
+    bias += ZUPT_BIAS_RATE * (rate - bias);
+    return 0.0f;
+  }
+  return std::abs(corrected) * legLength * dt;
+}
+
+bool zuptStance() { return stance; }
@@ -0,0 +1,13 @@
+#ifndef __ZUPT_H
+#define __ZUPT_H
+
+// Feed one angular rate sample (rad/s) about the swing axis, dt seconds
+// after the previous one. Returns the distance (m) the leg's linear velocity
+// covers over the sample, forced to zero whenever the stance phase holds the
+// leg still
+float updateZupt(float rate, float dt, float legLength);
+
+// Whether the leg is currently in the stance phase
+bool zuptStance();
+
+#endif
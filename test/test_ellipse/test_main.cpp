@@ -0,0 +1,50 @@
+#include <unity.h>
+
+#include "drivers/ellipse.h"
+
+// The display the drawing functions clip to
+#define WIDTH 240
+
+void setUp() {}
+void tearDown() {}
+
+// Every point of the walk lies within EllipseHalfWidth, so the clip box
+// drawn around it never claims a shape is inside when it is not
+static void checkWithinBox(int xRadius, int yRadius) {
+  EllipseWalkTypeDef walk;
+  int dx, dy;
+  int half = EllipseHalfWidth(xRadius, yRadius);
+
+  EllipseBegin(&walk, xRadius, yRadius);
+  while (EllipseNext(&walk, &dx, &dy)) {
+    TEST_ASSERT_TRUE(dx >= 0 && dx <= half);
+    TEST_ASSERT_TRUE(dy >= -yRadius && dy <= 0);
+  }
+}
+
+void test_all_radii() {
+  for (int xRadius = 1; xRadius <= 120; ++xRadius) {
+    for (int yRadius = 1; yRadius <= 160; ++yRadius) {
+      checkWithinBox(xRadius, yRadius);
+    }
+  }
+}
+
+// Tall and thin at either edge: the box must cross the edge, so that the
+// pixels off screen are clipped
+void test_thin_at_edges() {
+  const int radii[][2] = {{10, 40}, {5, 60}, {2, 150}};
+  for (const auto &r : radii) {
+    int half = EllipseHalfWidth(r[0], r[1]);
+    TEST_ASSERT_TRUE(0 - half < 0);
+    TEST_ASSERT_TRUE(WIDTH - 1 + half >= WIDTH);
+    checkWithinBox(r[0], r[1]);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_all_radii);
+  RUN_TEST(test_thin_at_edges);
+  return UNITY_END();
+}
@@ -0,0 +1,100 @@
+#include <unity.h>
+
+#include <cmath>
+#include <cstdlib>
+
+#include "history.h"
+
+// Small integers, so float sums are exact and compare equal
+static float samples[40000];
+
+void setUp() {}
+void tearDown() {}
+
+static uint32_t blockSize(int level) {
+  uint32_t size = 1;
+  while (level-- > 0) {
+    size *= HISTORY_FANOUT;
+  }
+  return size;
+}
+
+// Where range() starts: begin rounded down to the finest block still held
+static uint32_t coveredBegin(uint32_t total, uint32_t begin) {
+  int level = 0;
+  for (; level + 1 < HISTORY_LEVELS; ++level) {
+    if (begin / blockSize(level) + HISTORY_CAPACITY >=
+        total / blockSize(level)) {
+      break;
+    }
+  }
+  uint32_t size = blockSize(level);
+  uint32_t count = total / size;
+  if (begin / size + HISTORY_CAPACITY < count) {
+    begin = (count - HISTORY_CAPACITY) * size;
+  }
+  return begin - begin % size;
+}
+
+// Random ranges against a brute force scan of the samples they cover
+static void checkRanges(uint32_t total) {
+  HistoryPyramid history;
+  for (uint32_t i = 0; i < total; ++i) {
+    samples[i] = (float)(rand() % 10);
+    history.add(samples[i]);
+  }
+
+  for (int trial = 0; trial < 2000; ++trial) {
+    uint32_t begin = rand() % total;
+    uint32_t end = begin + 1 + rand() % (total - begin);
+    HistoryStats stats = history.range(begin, end);
+
+    uint32_t first = coveredBegin(total, begin);
+    uint32_t last = first + stats.count;
+    TEST_ASSERT_TRUE(last >= end);
+    TEST_ASSERT_TRUE(last <= total);
+    // Only aged out samples may be rounded; recent ranges are exact
+    if (begin + HISTORY_CAPACITY >= total) {
+      TEST_ASSERT_EQUAL_UINT32(begin, first);
+      TEST_ASSERT_EQUAL_UINT32(end, last);
+    }
+
+    float min = INFINITY, max = -INFINITY, sum = 0.0f, sumSquared = 0.0f;
+    for (uint32_t i = first; i < last; ++i) {
+      min = fminf(min, samples[i]);
+      max = fmaxf(max, samples[i]);
+      sum += samples[i];
+      sumSquared += samples[i] * samples[i];
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.0f, min, stats.min);
+    TEST_ASSERT_FLOAT_WITHIN(0.0f, max, stats.max);
+    TEST_ASSERT_FLOAT_WITHIN(0.0f, sum, stats.sum);
+    TEST_ASSERT_FLOAT_WITHIN(0.0f, sumSquared, stats.sumSquared);
+  }
+}
+
+// Recent ranges whose end falls in blocks not complete yet
+void test_partial_blocks() { checkRanges(1074); }
+
+// Long enough that the oldest samples are only left at the top level
+void test_aged_out() { checkRanges(40000); }
+
+// The covered samples all read 1, however the range is rounded
+void test_constant_mean() {
+  HistoryPyramid history;
+  for (int i = 0; i < 1074; ++i) {
+    history.add(1.0f);
+  }
+  HistoryStats stats = history.range(417, 1060);
+  TEST_ASSERT_EQUAL_UINT32(1060 - 384, stats.count);
+  TEST_ASSERT_FLOAT_WITHIN(0.0f, 1.0f, stats.mean());
+}
+
+int main() {
+  srand(1);
+  UNITY_BEGIN();
+  RUN_TEST(test_partial_blocks);
+  RUN_TEST(test_aged_out);
+  RUN_TEST(test_constant_mean);
+  return UNITY_END();
+}
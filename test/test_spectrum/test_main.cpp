@@ -0,0 +1,78 @@
+#include <unity.h>
+
+#include <cmath>
+
+#include "config.h"
+#include "spectrum.h"
+
+// Same test signal as spectrumSelfTest: two tones and a sawtooth
+static float signal(int i) {
+  return sinf(2.0f * 3.14159265f * 5.0f * i / SPECTRUM_SIZE) +
+         0.25f * cosf(2.0f * 3.14159265f * 17.0f * i / SPECTRUM_SIZE) +
+         0.1f * (float)(i % 7);
+}
+
+void setUp() { initSpectrum(); }
+void tearDown() {}
+
+// The backend built in against a direct DFT in double precision; on a
+// CMSIS-DSP build this checks arm_rfft_fast_f32, on the host the portable
+// FFT, against the same reference
+void test_rfft_matches_dft() {
+  static float in[SPECTRUM_SIZE], out[SPECTRUM_SIZE];
+  for (int i = 0; i < SPECTRUM_SIZE; ++i) {
+    in[i] = signal(i);
+  }
+  spectrumRfft(in, out);
+
+  for (int k = 0; k <= SPECTRUM_SIZE / 2; ++k) {
+    double re = 0.0, im = 0.0;
+    for (int i = 0; i < SPECTRUM_SIZE; ++i) {
+      double w = 2.0 * M_PI * k * i / SPECTRUM_SIZE;
+      re += signal(i) * cos(w);
+      im -= signal(i) * sin(w);
+    }
+    if (k == 0) {
+      TEST_ASSERT_FLOAT_WITHIN(1e-3f, re, out[0]);
+    } else if (k == SPECTRUM_SIZE / 2) {
+      TEST_ASSERT_FLOAT_WITHIN(1e-3f, re, out[1]);
+    } else {
+      TEST_ASSERT_FLOAT_WITHIN(1e-3f, re, out[2 * k]);
+      TEST_ASSERT_FLOAT_WITHIN(1e-3f, im, out[2 * k + 1]);
+    }
+  }
+}
+
+// CMSIS-DSP and the portable FFT on the same input
+void test_backends_agree() {
+  float worst = spectrumSelfTest();
+#if SPECTRUM_CMSIS
+  TEST_ASSERT_TRUE(worst >= 0.0f);
+  TEST_ASSERT_LESS_THAN_FLOAT(1e-3f, worst);
+#else
+  TEST_ASSERT_TRUE(worst < 0.0f);
+  TEST_IGNORE_MESSAGE("portable FFT only: build with -D SPECTRUM_CMSIS=1");
+#endif
+}
+
+// A 1 Hz swing sampled at 190 Hz: one stride a second, 120 steps a minute
+void test_cadence() {
+  bool ready = false;
+  for (int i = 0; i < 190 * 10; ++i) {
+    float t = i / 190.0f;
+    ready |= updateSpectrum(sinf(2.0f * 3.14159265f * t),
+                            1000000ULL + (uint64_t)(t * 1e6f));
+  }
+  TEST_ASSERT_TRUE(ready);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 1.0f, spectrumFrequency());
+  TEST_ASSERT_FLOAT_WITHIN(6.0f, 120.0f, spectrumCadence());
+  TEST_ASSERT_TRUE(spectrumBandEnergy() > 0.9f);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_rfft_matches_dft);
+  RUN_TEST(test_backends_agree);
+  RUN_TEST(test_cadence);
+  return UNITY_END();
+}
@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+"""Characterize the gyro noise and generate src/noise_model.h.
+
+Set CAPTURE_RAW to 1 (and DEBUG to 0) in src/config.h, flash, leave the
+board perfectly still, and record the binary stream, e.g. for two hours:
+
+    python3 tools/allan.py --port /dev/ttyACM0 --seconds 7200 --save still.bin
+
+or analyse captures recorded earlier:
+
+    python3 tools/allan.py still.bin
+
+The tool computes the overlapping Allan deviation of each axis, reads off
+the angle random walk, bias instability and rate random walk, and writes
+the recommended filter and threshold constants. Without any capture it
+writes the baseline hand-tuned values. Needs numpy (and pyserial to record).
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+import numpy as np
+
+MAGIC = 0x5247  # CAPTURE_MAGIC
+BLOCK_SAMPLES = 32  # CAPTURE_BLOCK_SAMPLES
+BAUD = 921600  # CAPTURE_BAUD
+HEADER = struct.Struct("<4H")
+BLOCK_BYTES = HEADER.size + BLOCK_SAMPLES * 6
+
+# SCALING_FACTOR: 17.5 mdps per LSB at 500 dps, in rad/s
+SCALE = 17.5 * math.pi / 180.0 / 1000.0
+# Tick of the display path (SAMPLE_INTERVAL_MS) and ZUPT_WINDOW
+TICK_S = 0.5
+ZUPT_WINDOW = 16
+# Half of the last digit shown on the display (%2.2f)
+DISPLAY_RESOLUTION = 0.005
+
+BASELINE = {
+    "FILTER_COEFFICIENT": 0.1,
+    "WAKE_THRESHOLD": 0.5,
+    "TEMP_STILL_VARIANCE": 400,
+    "ZUPT_THRESHOLD": 0.05,
+    "OUTLIER_FLOOR": 0.5,
+}
+
+
+def record(port, seconds, out):
+    import serial
+
+    # The firmware stamps every block with the rate it samples at: take it
+    # from the first whole block rather than assuming the default ODR
+    head, rate_hz, received = b"", None, 0
+    with serial.Serial(port, BAUD, timeout=2) as link, open(out, "wb") as f:
+        while rate_hz is None or received * BLOCK_SAMPLES < seconds * rate_hz * BLOCK_BYTES:
+            data = link.read(BLOCK_BYTES)
+            if not data:
+                sys.exit("no data from %s: is CAPTURE_RAW set?" % port)
+            f.write(data)
+            received += len(data)
+            if rate_hz is None:
+                head += data
+                rate_hz = parse(head)[0]
+            elif received // BLOCK_BYTES % 100 == 0:
+                elapsed = received // BLOCK_BYTES * BLOCK_SAMPLES // rate_hz
+                print("\r%d s at %d Hz" % (elapsed, rate_hz), end="", flush=True)
+    print()
+
+
+def parse(data):
+    """Return (rate, segments): runs of blocks without sequence gaps."""
+    segments, current = [], []
+    rate, expected, pos = None, None, 0
+    while pos + BLOCK_BYTES <= len(data):
+        magic, sequence, count, block_rate = HEADER.unpack_from(data, pos)
+        if magic != MAGIC or count != BLOCK_SAMPLES:
+            pos += 1  # resynchronize on the next magic
+            continue
+        if expected is not None and sequence != expected and current:
+            segments.append(current)
+            current = []
+        rate = rate or block_rate
+        samples = np.frombuffer(
+            data, dtype="<i2", count=BLOCK_SAMPLES * 3, offset=pos + HEADER.size
+        )
+        current.append(samples.reshape(-1, 3))
+        expected = (sequence + 1) & 0xFFFF
+        pos += BLOCK_BYTES
+    if current:
+        segments.append(current)
+    return rate, [np.concatenate(s) for s in segments]
+
+
+def allan_deviation(rate, tau0):
+    """Overlapping Allan deviation at log-spaced cluster sizes.
+
+    With the integrated angle theta, each cluster size m costs one O(N)
+    vectorized pass. The 100 log-spaced sizes (fewer once rounded to
+    integers) make it O(N) in total, with a constant of up to 100 passes.
+    """
+    n = len(rate)
+    theta = np.concatenate(([0.0], np.cumsum(rate) * tau0))
+    sizes = np.unique(np.logspace(0, math.log10((n - 1) // 2), 100).astype(int))
+    taus, adev = [], []
+    for m in sizes:
+        d = theta[2 * m :] - 2.0 * theta[m:-m] + theta[: -2 * m]
+        tau = m * tau0
+        taus.append(tau)
+        adev.append(math.sqrt(np.dot(d, d) / (2.0 * tau * tau * len(d))))
+    return np.array(taus), np.array(adev)
+
+
+def read_slope(taus, adev, slope, at):
+    """Coefficient of the slope line through the points that follow it."""
+    logs = np.gradient(np.log(adev), np.log(taus))
+    on_line = np.abs(logs - slope) < 0.1
+    if not on_line.any():
+        return None
+    return float(np.median(adev[on_line] * (at / taus[on_line]) ** slope))
+
+
+def characterize(raw, rate_hz):
+    tau0 = 1.0 / rate_hz
+    axes = []
+    for axis in range(3):
+        counts = raw[:, axis].astype(float)
+        rate = counts * SCALE
+        taus, adev = allan_deviation(rate, tau0)
+        lowest = int(np.argmin(adev))
+        # Short-window energy of the de-meaned rate, as ZUPT sees it at rest
+        centred = rate - rate.mean()
+        window = np.convolve(centred**2, np.ones(ZUPT_WINDOW) / ZUPT_WINDOW, "valid")
+        axes.append(
+            {
+                "sd_lsb": float(counts.std()),
+                "sd": float(rate.std()),
+                "arw": read_slope(taus, adev, -0.5, 1.0),
+                "bias_instability": float(adev[lowest] / 0.664),
+                "bias_tau": float(taus[lowest]),
+                "rrw": read_slope(taus, adev, 0.5, 3.0),
+                "rest_energy": float(np.percentile(window, 99.9)),
+            }
+        )
+    return axes
+
+
+def recommend(axes):
+    sd = max(a["sd"] for a in axes)
+    sd_lsb = max(a["sd_lsb"] for a in axes)
+    bias = max(a["bias_instability"] for a in axes)
+    rest = max(a["rest_energy"] for a in axes)
+    # EMA of single samples: variance alpha / (2 - alpha) of the input. Take
+    # the least smoothing that keeps the shown last digit steady
+    r2 = DISPLAY_RESOLUTION**2
+    alpha = min(1.0, max(0.01, 2.0 * r2 / (sd * sd + r2)))
+    return {
+        "FILTER_COEFFICIENT": alpha,
+        # Far above noise plus residual bias, so idle does not wake itself
+        "WAKE_THRESHOLD": 8.0 * sd + 3.0 * bias,
+        # Raw block variance: the noise with room for slow drift
+        "TEMP_STILL_VARIANCE": int(math.ceil(4.0 * sd_lsb * sd_lsb)),
+        # Leg at rest: 99.9th percentile energy, with room for a standing leg
+        "ZUPT_THRESHOLD": 4.0 * rest,
+        # A spike must clear six standard deviations of noise
+        "OUTLIER_FLOOR": 6.0 * sd,
+    }
+
+
+def format_value(name, value):
+    if name == "TEMP_STILL_VARIANCE":
+        return "%d" % value
+    text = "%.6g" % value
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def emit(values, source, notes, out):
+    lines = [
+        "// Generated by tools/allan.py, do not edit",
+        "// Constants: %s" % source,
+    ]
+    lines += ["// " + note for note in notes]
+    lines += ["#ifndef __NOISE_MODEL_H", "#define __NOISE_MODEL_H", ""]
+    for name in BASELINE:
+        lines.append("#define NOISE_%s %s" % (name, format_value(name, values[name])))
+    lines += ["", "#endif", ""]
+    with open(out, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("captures", nargs="*", help="binary captures")
+    parser.add_argument("--port", help="record from this serial port first")
+    parser.add_argument("--seconds", type=float, default=3600, help="to record")
+    parser.add_argument("--save", default="capture.bin", help="recording file")
+    parser.add_argument(
+        "--out",
+        default=os.path.join(os.path.dirname(__file__), "..", "src", "noise_model.h"),
+    )
+    args = parser.parse_args()
+
+    captures = list(args.captures)
+    if args.port:
+        record(args.port, args.seconds, args.save)
+        captures.append(args.save)
+
+    if not captures:
+        emit(BASELINE, "baseline, hand-tuned", [], args.out)
+        print("wrote baseline to %s" % os.path.normpath(args.out))
+        return
+
+    segments, rate_hz = [], None
+    for path in captures:
+        with open(path, "rb") as f:
+            rate, found = parse(f.read())
+        if found:
+            if rate_hz and rate != rate_hz:
+                sys.exit("%s: captured at %d Hz, others at %d Hz" % (path, rate, rate_hz))
+            rate_hz = rate
+            segments += found
+    if not segments:
+        sys.exit("no capture blocks found")
+    # Allan variance needs a gap-free run: use the longest one
+    raw = max(segments, key=len)
+    if len(segments) > 1:
+        print("%d gaps in the stream, using the longest run" % (len(segments) - 1))
+    if len(raw) < 1000:
+        sys.exit("capture too short: %d samples" % len(raw))
+
+    axes = characterize(raw, rate_hz)
+    notes = ["%d samples at %d Hz (%.0f s)" % (len(raw), rate_hz, len(raw) / rate_hz)]
+    for name, a in zip("xyz", axes):
+        def show(value):
+            return "n/a" if value is None else "%.3g" % value
+
+        notes.append(
+            "%s: ARW %s rad/s/sqrt(Hz), bias instability %.3g rad/s at %.0f s, "
+            "RRW %s rad/s^2/sqrt(Hz)"
+            % (name, show(a["arw"]), a["bias_instability"], a["bias_tau"], show(a["rrw"]))
+        )
+    for note in notes:
+        print(note)
+    emit(recommend(axes), "measured", notes, args.out)
+    print("wrote %s" % os.path.normpath(args.out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+"""Pack images into src/drivers/bitmap_pack.{c,h} for BSP_LCD_DrawPackedBitmap.
+
+Each image is scaled to the given width, reduced to a palette, and stored
+in the smallest of three layouts:
+
+  l4   4 bit palette indices, two pixels per byte, at most 16 colours
+  l8   8 bit palette indices, at most 256 colours
+  rle  runs of (count, index) pairs, row by row; best for flat art
+
+L4 and L8 are drawn with a single DMA2D transfer that looks the indices up
+in its CLUT; RLE runs are filled as spans. Name each image after a colon,
+and give its width after an @ (the height keeps the aspect ratio):
+
+    python3 tools/pack_bitmaps.py assets/img/RTES-teaser.drawio.png:splash@240
+
+Transparent pixels are composited on white. Reads 8 bit PNG files with
+the standard library only.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+DRIVERS = os.path.join(ROOT, "src", "drivers")
+BASELINE = ["assets/img/RTES-teaser.drawio.png:splash@240"]
+
+FORMATS = {"l4": "BITMAP_FORMAT_L4", "l8": "BITMAP_FORMAT_L8", "rle": "BITMAP_FORMAT_RLE8"}
+
+
+def read_png(path):
+    """Return (width, height, rows of (r, g, b)) of an 8 bit PNG."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s: not a PNG file" % path)
+    pos, idat, palette, alpha = 8, b"", [], []
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos : pos + 8])
+        chunk = data[pos + 8 : pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i : i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            alpha = list(chunk)
+        elif kind == b"IDAT":
+            idat += chunk
+    if depth != 8 or interlace:
+        sys.exit("%s: only 8 bit, non-interlaced PNG files are supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows, previous = [], bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1 : (y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = previous[i]
+            c = previous[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        previous = line
+        pixels = []
+        for x in range(width):
+            v = line[x * channels : (x + 1) * channels]
+            if color == 3:
+                rgb, a = palette[v[0]], alpha[v[0]] if v[0] < len(alpha) else 255
+            elif color in (0, 4):
+                rgb, a = (v[0],) * 3, v[1] if color == 4 else 255
+            else:
+                rgb, a = tuple(v[:3]), v[3] if color == 6 else 255
+            # On white, as the display's back colour
+            pixels.append(tuple((c * a + 255 * (255 - a)) // 255 for c in rgb))
+        rows.append(pixels)
+    return width, height, rows
+
+
+def scale(width, height, rows, out_width):
+    """Box filter down to out_width, keeping the aspect ratio."""
+    out_height = max(1, round(height * out_width / width))
+    out = []
+    for oy in range(out_height):
+        y0, y1 = oy * height // out_height, max(oy * height // out_height + 1, (oy + 1) * height // out_height)
+        line = []
+        for ox in range(out_width):
+            x0, x1 = ox * width // out_width, max(ox * width // out_width + 1, (ox + 1) * width // out_width)
+            block = [rows[y][x] for y in range(y0, y1) for x in range(x0, x1)]
+            line.append(tuple(sum(p[c] for p in block) // len(block) for c in range(3)))
+        out.append(line)
+    return out_width, out_height, out
+
+
+def median_cut(pixels, colours):
+    """Palette of up to colours entries by splitting the widest box."""
+    boxes = [sorted(set(pixels))]
+    while len(boxes) < colours:
+        spans = [(max(max(p[c] for p in b) - min(p[c] for p in b) for c in range(3)), i)
+                 for i, b in enumerate(boxes) if len(b) > 1]
+        if not spans:
+            break
+        _, i = max(spans)
+        box = boxes.pop(i)
+        channel = max(range(3), key=lambda c: max(p[c] for p in box) - min(p[c] for p in box))
+        box.sort(key=lambda p: p[channel])
+        boxes += [box[: len(box) // 2], box[len(box) // 2 :]]
+    return [tuple(sum(p[c] for p in b) // len(b) for c in range(3)) for b in boxes]
+
+
+def quantize(rows, colours):
+    pixels = [p for row in rows for p in row]
+    palette = median_cut(pixels, colours)
+    nearest = {}
+    for p in set(pixels):
+        nearest[p] = min(range(len(palette)),
+                         key=lambda i: sum((p[c] - palette[i][c]) ** 2 for c in range(3)))
+    return palette, [[nearest[p] for p in row] for row in rows]
+
+
+def encode(indices, width, fmt):
+    out = []
+    for row in indices:
+        if fmt == "l8":
+            out += row
+        elif fmt == "l4":
+            padded = row + row[-1:] * (len(row) % 2)
+            out += [padded[x] | padded[x + 1] << 4 for x in range(0, len(padded), 2)]
+        else:
+            x = 0
+            while x < width:
+                run = 1
+                while x + run < width and run < 255 and row[x + run] == row[x]:
+                    run += 1
+                out += [run, row[x]]
+                x += run
+    return out
+
+
+def pack(spec, colours, fmt):
+    match = re.match(r"^(.*?)(?::(\w+))?(?:@(\d+))?$", spec)
+    path, name, width = match.group(1), match.group(2), match.group(3)
+    name = name or re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+    w, h, rows = read_png(os.path.join(ROOT, path) if not os.path.isabs(path) else path)
+    if width:
+        w, h, rows = scale(w, h, rows, int(width))
+    palette, indices = quantize(rows, colours)
+    candidates = [fmt] if fmt != "auto" else (["l4", "rle"] if len(palette) <= 16 else ["l8", "rle"])
+    if "l4" in candidates and len(palette) > 16:
+        sys.exit("%s: %d colours do not fit l4" % (path, len(palette)))
+    data, fmt = min([(encode(indices, w, f), f) for f in candidates], key=lambda e: len(e[0]))
+    return name, w, h, palette, fmt, data
+
+
+def emit(bitmaps):
+    header = [
+        "/* Generated by tools/pack_bitmaps.py, do not edit */",
+        "#ifndef __BITMAP_PACK_H",
+        "#define __BITMAP_PACK_H",
+        "",
+        '#include "bitmaps.h"',
+        "",
+        "#ifdef __cplusplus",
+        ' extern "C" {',
+        "#endif",
+        "",
+    ]
+    header += ["extern const sBITMAP Bitmap_%s;" % b[0] for b in bitmaps]
+    header += ["", "#ifdef __cplusplus", "}", "#endif", "", "#endif /* __BITMAP_PACK_H */", ""]
+
+    source = ["/* Generated by tools/pack_bitmaps.py, do not edit */", '#include "bitmap_pack.h"', ""]
+    for name, width, height, palette, fmt, data in bitmaps:
+        source.append("static const uint32_t Bitmap_%s_Palette[] = {" % name)
+        for i in range(0, len(palette), 8):
+            source.append("  " + " ".join("0x%08X," % (0xFF000000 | r << 16 | g << 8 | b)
+                                          for r, g, b in palette[i : i + 8]))
+        source += ["};", "", "static const uint8_t Bitmap_%s_Data[] = {" % name]
+        for i in range(0, len(data), 16):
+            source.append("  " + " ".join("0x%02X," % v for v in data[i : i + 16]))
+        source += [
+            "};",
+            "",
+            "const sBITMAP Bitmap_%s = {" % name,
+            "  Bitmap_%s_Data," % name,
+            "  Bitmap_%s_Palette," % name,
+            "  %d, /* Width */" % width,
+            "  %d, /* Height */" % height,
+            "  %d, /* Colors */" % len(palette),
+            "  %s," % FORMATS[fmt],
+            "};",
+            "",
+        ]
+
+    with open(os.path.join(DRIVERS, "bitmap_pack.h"), "w") as f:
+        f.write("\n".join(header))
+    with open(os.path.join(DRIVERS, "bitmap_pack.c"), "w") as f:
+        f.write("\n".join(source))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("images", nargs="*", default=BASELINE, help="path[:name][@width]")
+    parser.add_argument("--colors", type=int, default=16, help="palette size, 2 to 256")
+    parser.add_argument("--format", choices=["auto"] + list(FORMATS), default="auto")
+    args = parser.parse_args()
+    if not 2 <= args.colors <= 256:
+        sys.exit("--colors must be between 2 and 256")
+
+    bitmaps = [pack(spec, args.colors, args.format) for spec in args.images]
+    emit(bitmaps)
+    for name, width, height, palette, fmt, data in bitmaps:
+        print("Bitmap_%s: %dx%d, %d colours, %s, %d bytes instead of %d as ARGB8888"
+              % (name, width, height, len(palette), fmt, len(data) + 4 * len(palette),
+                 4 * width * height))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+"""Generate src/drivers/font_subset.{c,h} with only the glyphs the app uses.
+
+The characters are those of the string literals in the application
+sources (src/*.cpp, src/*.h) plus the digits, sign and decimal point.
+printf formats (literals with a % or a newline) are skipped.
+Each font size named on the command line gets a FontNNSubset holding just
+those glyphs, taken from src/drivers/fontNN.c:
+
+    python3 tools/subset_font.py 16
+
+By default the glyphs keep the packed 1 bit per pixel rows of the full
+fonts. With --format argb8888 they are expanded to frame buffer pixels in
+the given colours, and drawing a character becomes a DMA2D copy; this
+costs 4 bytes per pixel of flash, so keep the subset small.
+
+With --format a8 or a4 the glyphs are coverage masks (8 or 4 bits per
+pixel) that DMA2D blends in the text colour. Take the shapes from a
+larger font to get anti-aliased small text, e.g. Font24 scaled down to
+the Font12 cell:
+
+    python3 tools/subset_font.py 12 --format a8 --source 24
+
+A4 glyphs are padded to an even width, so each row fills whole bytes.
+
+Re-run it whenever the displayed text changes; characters outside the
+subset are drawn as a space.
+"""
+
+import argparse
+import glob
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+DRIVERS = os.path.join(ROOT, "src", "drivers")
+ALWAYS = " 0123456789-."
+FIRST, LAST = 0x20, 0x7E
+
+STRING = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+
+
+def used_characters(extra):
+    chars = set(ALWAYS + extra)
+    sources = glob.glob(os.path.join(ROOT, "src", "*.cpp"))
+    sources += glob.glob(os.path.join(ROOT, "src", "*.h"))
+    for path in sources:
+        with open(path) as f:
+            text = re.sub(r"//[^\n]*", "", f.read())
+        for literal in STRING.findall(text):
+            # printf formats go to the serial port, not the display
+            if "%" in literal or "\\n" in literal:
+                continue
+            literal = re.sub(r"\\.", "", literal)
+            chars.update(c for c in literal if FIRST <= ord(c) <= LAST)
+    return sorted(chars)
+
+
+def read_font(size):
+    path = os.path.join(DRIVERS, "font%d.c" % size)
+    with open(path) as f:
+        text = f.read()
+    match = re.search(
+        r"sFONT Font%d = \{\s*Font%d_Table,\s*(\d+),[^,]*?(\d+),?" % (size, size), text
+    )
+    if not match:
+        sys.exit("%s: no sFONT Font%d" % (path, size))
+    width, height = int(match.group(1)), int(match.group(2))
+    body = text[re.search(r"Font%d_Table\s*\[\]" % size, text).start() :]
+    body = body[body.index("{") + 1 : body.index("};")]
+    data = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", re.sub(r"//[^\n]*", "", body))]
+    stride = (width + 7) // 8 * height
+    if len(data) != stride * (LAST - FIRST + 1):
+        sys.exit("%s: unexpected table size %d" % (path, len(data)))
+    glyphs = [data[i * stride : (i + 1) * stride] for i in range(LAST - FIRST + 1)]
+    return width, height, glyphs
+
+
+def expand(glyph, width, height, fg, bg):
+    """Packed rows to ARGB8888 words, as DrawChar reads them."""
+    row_bytes = (width + 7) // 8
+    offset = 8 * row_bytes - width
+    pixels = []
+    for y in range(height):
+        line = 0
+        for b in glyph[y * row_bytes : (y + 1) * row_bytes]:
+            line = (line << 8) | b
+        for x in range(width):
+            pixels.append(fg if line & (1 << (width - x + offset - 1)) else bg)
+    return pixels
+
+
+def coverage(glyph, width, height, out_width, out_height):
+    """Area-average the 1 bit glyph onto an out_width x out_height grid.
+
+    Each output pixel gets the fraction of its area the glyph's set pixels
+    cover, as 0..255.
+    """
+    bits = expand(glyph, width, height, 1, 0)
+    sx, sy = width / out_width, height / out_height
+    values = []
+    for oy in range(out_height):
+        y0, y1 = oy * sy, (oy + 1) * sy
+        for ox in range(out_width):
+            x0, x1 = ox * sx, (ox + 1) * sx
+            total = 0.0
+            for iy in range(int(y0), min(height, int(math.ceil(y1)))):
+                wy = min(y1, iy + 1) - max(y0, iy)
+                for ix in range(int(x0), min(width, int(math.ceil(x1)))):
+                    if bits[iy * width + ix]:
+                        total += wy * (min(x1, ix + 1) - max(x0, ix))
+            values.append(int(round(255 * total / (sx * sy))))
+    return values
+
+
+def pack_a4(values, width, height):
+    """Two pixels per byte, the first in the low nibble."""
+    out = []
+    for y in range(height):
+        row = values[y * width : (y + 1) * width]
+        for x in range(0, width, 2):
+            out.append((row[x] + 8) // 17 | ((row[x + 1] + 8) // 17) << 4)
+    return out
+
+
+FORMATS = {
+    "bits": "FONT_FORMAT_BITS",
+    "argb8888": "FONT_FORMAT_ARGB8888",
+    "a8": "FONT_FORMAT_A8",
+    "a4": "FONT_FORMAT_A4",
+}
+
+
+def describe(c):
+    return "' '" if c == " " else "'%s'" % c.replace("\\", "\\\\")
+
+
+def emit(fonts, chars, fmt, fg, bg):
+    header = [
+        "/* Generated by tools/subset_font.py, do not edit */",
+        "#ifndef __FONT_SUBSET_H",
+        "#define __FONT_SUBSET_H",
+        "",
+        '#include "fonts.h"',
+        "",
+        "#ifdef __cplusplus",
+        ' extern "C" {',
+        "#endif",
+        "",
+    ]
+    header += ["extern sFONT Font%dSubset;" % size for size, _ in fonts]
+    header += [
+        "",
+        "/* Characters held by the subset fonts */",
+        '#define FONT_SUBSET_CHARS "%s"'
+        % "".join(chars).replace("\\", "\\\\").replace('"', '\\"'),
+        "",
+        "#ifdef __cplusplus",
+        "}",
+        "#endif",
+        "",
+        "#endif /* __FONT_SUBSET_H */",
+        "",
+    ]
+
+    source = [
+        "/* Generated by tools/subset_font.py, do not edit */",
+        '#include "font_subset.h"',
+        "",
+    ]
+    for size, (width, height, glyphs) in fonts:
+        name = "Font%dSubset" % size
+        source.append("static const %s %s_Table[] = {" % (
+            "uint32_t" if fmt == "argb8888" else "uint8_t", name))
+        for c in chars:
+            glyph = glyphs[ord(c) - FIRST]
+            source.append("  /* %s */" % describe(c))
+            if fmt in ("a8", "a4"):
+                # Coverage, already at the cell size
+                per_row = width if fmt == "a8" else width // 2
+                data = glyph if fmt == "a8" else pack_a4(glyph, width, height)
+                for y in range(height):
+                    row = data[y * per_row : (y + 1) * per_row]
+                    source.append("  " + " ".join("0x%02X," % b for b in row))
+            elif fmt == "argb8888":
+                words = expand(glyph, width, height, fg, bg)
+                for y in range(height):
+                    row = words[y * width : (y + 1) * width]
+                    source.append("  " + " ".join("0x%08X," % w for w in row))
+            else:
+                row_bytes = (width + 7) // 8
+                for y in range(height):
+                    row = glyph[y * row_bytes : (y + 1) * row_bytes]
+                    source.append("  " + " ".join("0x%02X," % b for b in row))
+        source.append("};")
+        source.append("")
+        source.append("static const uint8_t %s_Map[] = {" % name)
+        entries = []
+        for code in range(FIRST, LAST + 1):
+            c = chr(code)
+            entries.append("%d" % chars.index(c) if c in chars else "0xFF")
+        source[-1] += "  /* from ' ', 0xFF = FONT_GLYPH_MISSING */"
+        for i in range(0, len(entries), 12):
+            source.append("  " + ", ".join(entries[i : i + 12]) + ",")
+        source.append("};")
+        source.append("")
+        source.append("sFONT %s = {" % name)
+        source.append("  (const uint8_t *)%s_Table," % name)
+        source.append("  %d, /* Width */" % width)
+        source.append("  %d, /* Height */" % height)
+        source.append("  %s_Map," % name)
+        source.append("  %s," % FORMATS[fmt])
+        source.append("};")
+        source.append("")
+
+    with open(os.path.join(DRIVERS, "font_subset.h"), "w") as f:
+        f.write("\n".join(header))
+    with open(os.path.join(DRIVERS, "font_subset.c"), "w") as f:
+        f.write("\n".join(source))
+
+
+def masks(font, source, fmt):
+    """Coverage masks at the cell size of font, shaped after font source."""
+    width, height, _ = font
+    shapes = read_font(source) if source else font
+    glyphs = [coverage(g, shapes[0], shapes[1], width, height) for g in shapes[2]]
+    if fmt == "a4" and width % 2:
+        # A blank column on the right, so each row fills whole bytes
+        glyphs = [sum((g[y * width : (y + 1) * width] + [0] for y in range(height)), [])
+                  for g in glyphs]
+        width += 1
+    return width, height, glyphs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("sizes", nargs="*", type=int, default=[16], help="font sizes")
+    parser.add_argument("--format", choices=list(FORMATS), default="bits")
+    parser.add_argument("--source", type=int, help="font size to take a8/a4 shapes from")
+    parser.add_argument("--fg", type=lambda v: int(v, 0), default=0xFF000000, help="text colour")
+    parser.add_argument("--bg", type=lambda v: int(v, 0), default=0xFFFFFFFF, help="back colour")
+    parser.add_argument("--chars", default="", help="characters to add")
+    args = parser.parse_args()
+
+    chars = used_characters(args.chars)
+    if len(chars) > 254:
+        sys.exit("too many glyphs for uint8_t indices")
+    fonts = [(size, read_font(size)) for size in sorted(set(args.sizes))]
+    full = {size: (width + 7) // 8 * height * (LAST - FIRST + 1) for size, (width, height, _) in fonts}
+    if args.format in ("a8", "a4"):
+        fonts = [(size, masks(font, args.source, args.format)) for size, font in fonts]
+    elif args.source:
+        sys.exit("--source only applies to a8 and a4")
+    emit(fonts, chars, args.format, args.fg, args.bg)
+
+    bits_per_pixel = {"bits": 1, "argb8888": 32, "a8": 8, "a4": 4}[args.format]
+    for size, (width, height, _) in fonts:
+        if args.format == "bits":
+            per_glyph = (width + 7) // 8 * height
+        else:
+            per_glyph = width * height * bits_per_pixel // 8
+        print("Font%dSubset: %d of %d glyphs, %d bytes instead of %d"
+              % (size, len(chars), LAST - FIRST + 1, per_glyph * len(chars) + 95, full[size]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""Train the activity classifier and generate src/activity_tree.h.
+
+Record traces with DEBUG set to 1 in src/config.h: once per second the
+firmware prints a line
+
+    features,<variance>,<band energy>,<cadence>,<peak rate>
+
+Save one serial capture per activity, named after it (still*.txt,
+walk*.txt, run*.txt, stairs*.txt), then run
+
+    python3 tools/train_activity.py traces/*.txt
+
+Lines that are not feature lines are ignored. Without any trace the
+script writes the baseline hand-tuned tree.
+"""
+
+import argparse
+import os
+import sys
+
+CLASSES = ["still", "walk", "run", "stairs"]
+FEATURES = ["variance", "band energy", "cadence", "peak rate"]
+FEATURE_ENUMS = [
+    "FEATURE_VARIANCE",
+    "FEATURE_BAND_ENERGY",
+    "FEATURE_CADENCE",
+    "FEATURE_PEAK_RATE",
+]
+CLASS_ENUMS = ["ACTIVITY_STILL", "ACTIVITY_WALK", "ACTIVITY_RUN", "ACTIVITY_STAIRS"]
+
+# Used when no traces are given: (feature, threshold, left, right) or class
+BASELINE = (
+    0, 0.05,
+    "still",
+    (2, 140.0,
+     # Brisk walks swing faster than 5 rad/s too: stairs are told apart
+     # by their slow cadence, then by the high knee lift
+     (2, 100.0,
+      (3, 4.0, "walk", "stairs"),
+      "walk"),
+     "run"),
+)
+
+
+def read_traces(paths):
+    samples = []
+    for path in paths:
+        label = os.path.basename(path).lower()
+        matches = [c for c in CLASSES if label.startswith(c)]
+        if not matches:
+            sys.exit("%s: file name must start with one of %s" % (path, CLASSES))
+        target = CLASSES.index(matches[0])
+        with open(path) as f:
+            for line in f:
+                parts = line.strip().split(",")
+                if len(parts) != 1 + len(FEATURES) or parts[0] != "features":
+                    continue
+                samples.append(([float(v) for v in parts[1:]], target))
+    return samples
+
+
+def gini(counts):
+    total = sum(counts)
+    if total == 0:
+        return 0.0
+    return 1.0 - sum((c / total) ** 2 for c in counts)
+
+
+def class_counts(samples):
+    counts = [0] * len(CLASSES)
+    for _, target in samples:
+        counts[target] += 1
+    return counts
+
+
+def best_split(samples, min_leaf):
+    best = None
+    parent = gini(class_counts(samples)) * len(samples)
+    for feature in range(len(FEATURES)):
+        ordered = sorted(samples, key=lambda s: s[0][feature])
+        left = [0] * len(CLASSES)
+        right = class_counts(ordered)
+        for i in range(len(ordered) - 1):
+            target = ordered[i][1]
+            left[target] += 1
+            right[target] -= 1
+            a, b = ordered[i][0][feature], ordered[i + 1][0][feature]
+            if a == b or i + 1 < min_leaf or len(ordered) - i - 1 < min_leaf:
+                continue
+            cost = gini(left) * (i + 1) + gini(right) * (len(ordered) - i - 1)
+            if cost < parent and (best is None or cost < best[0]):
+                best = (cost, feature, (a + b) / 2.0)
+    return best
+
+
+def train(samples, depth, min_leaf):
+    counts = class_counts(samples)
+    majority = CLASSES[counts.index(max(counts))]
+    if depth == 0 or max(counts) == len(samples):
+        return majority
+    split = best_split(samples, min_leaf)
+    if split is None:
+        return majority
+    _, feature, threshold = split
+    left = [s for s in samples if s[0][feature] < threshold]
+    right = [s for s in samples if s[0][feature] >= threshold]
+    return (
+        feature,
+        threshold,
+        train(left, depth - 1, min_leaf),
+        train(right, depth - 1, min_leaf),
+    )
+
+
+def flatten(tree):
+    """Breadth-first node list of (feature, threshold, left, right)."""
+    nodes = []
+    queue = [tree]
+    while queue:
+        node = queue.pop(0)
+        if isinstance(node, str):
+            nodes.append((-1, 0.0, CLASSES.index(node), 0))
+            continue
+        feature, threshold, left, right = node
+        first = len(nodes) + len(queue) + 1
+        nodes.append((feature, threshold, first, first + 1))
+        queue.extend([left, right])
+    return nodes
+
+
+def float_literal(value):
+    text = "%.6g" % value
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def emit(nodes, source, out):
+    lines = [
+        "// Generated by tools/train_activity.py, do not edit",
+        "// Thresholds: %s" % source,
+        "#ifndef __ACTIVITY_TREE_H",
+        "#define __ACTIVITY_TREE_H",
+        "",
+        '#include "activity.h"',
+        "",
+        "constexpr ActivityNode activityTree[] = {",
+    ]
+    for i, (feature, threshold, left, right) in enumerate(nodes):
+        if feature < 0:
+            lines.append("    {-1, 0.0f, %s, 0},  // %d" % (CLASS_ENUMS[left], i))
+        else:
+            lines.append(
+                "    {%s, %s, %d, %d},  // %d"
+                % (FEATURE_ENUMS[feature], float_literal(threshold), left, right, i)
+            )
+    lines += ["};", "", "#endif", ""]
+    with open(out, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("traces", nargs="*", help="serial captures")
+    parser.add_argument("--depth", type=int, default=4, help="maximum tree depth")
+    parser.add_argument("--min-leaf", type=int, default=5, help="samples per leaf")
+    parser.add_argument(
+        "--out",
+        default=os.path.join(os.path.dirname(__file__), "..", "src", "activity_tree.h"),
+    )
+    args = parser.parse_args()
+
+    if args.traces:
+        samples = read_traces(args.traces)
+        if not samples:
+            sys.exit("no feature lines found")
+        tree = train(samples, args.depth, args.min_leaf)
+        source = "trained on %d feature rows" % len(samples)
+    else:
+        tree = BASELINE
+        source = "baseline, hand-tuned"
+
+    nodes = flatten(tree)
+    if len(nodes) > 255:
+        sys.exit("tree too large for uint8_t node indices")
+    emit(nodes, source, args.out)
+    print("wrote %d nodes to %s" % (len(nodes), os.path.normpath(args.out)))
+
+
+if __name__ == "__main__":
+    main()